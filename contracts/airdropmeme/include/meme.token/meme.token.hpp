@@ -77,8 +77,8 @@ namespace meme_token
         struct [[eosio::table]] account
         {
             asset balance;
-            bool  is_frozen = false;
             bool  is_fee_exempted = false;
+            bool  airdropmode_allow_transfer = false;
 
             uint64_t primary_key() const { return balance.symbol.code().raw(); }
         };
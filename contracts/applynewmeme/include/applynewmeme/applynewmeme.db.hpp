@@ -24,6 +24,9 @@ using namespace eosio;
 
 static constexpr uint32_t MAX_LOGO_SIZE        = 512;
 static constexpr uint32_t MAX_TITLE_SIZE        = 2048;
+static constexpr uint32_t MAX_LAUNCH_ROWS       = 20;           //memes advanced by one processlaunch
+static constexpr uint32_t MAX_GC_ROWS           = 50;           //applications erased by one gcmemes
+static constexpr uint32_t MEME_APPLY_TTL        = 7 * 24 * 3600;  //seconds an unpaid application is kept
 
 #define TBL struct [[eosio::table, eosio::contract("applynewmeme")]]
 #define NTBL(name) struct [[eosio::table(name), eosio::contract("applynewmeme")]]
@@ -44,6 +47,15 @@ NTBL("global") global_t {
 
 typedef eosio::singleton< "global"_n, global_t > global_singleton;
 
+//meme_t.status, a paid meme is launched one stage per action and can be retried from the last stage
+namespace meme_status {
+    static constexpr name INIT              = "init"_n;            //申请, waiting for the quote coin
+    static constexpr name SCHEDULED         = "scheduled"_n;       //paid, waiting for issue_at
+    static constexpr name POOL_CREATED      = "poolcreated"_n;     //token and hootswap pool created
+    static constexpr name LIQUIDITY_ADDED   = "liquidadded"_n;     //pool minted and configured
+    static constexpr name DONE              = "applied"_n;         //airdrop set, launch done
+}
+
 //scope: _self
 TBL meme_t {
     name                    applicant;                          //sequence
@@ -61,8 +73,9 @@ TBL meme_t {
     bool                    airdrop_enable;                     //是否开启空投
     string                  issue_at;                           //发行时间
     name                    swap_tradepair;                     //交易对
-    name                    status;                             //状态  enable disable
+    name                    status;                             //状态, see meme_status
     time_point_sec          created_at;
+    eosio::binary_extension<time_point_sec> airdrop_end;        //airdrop mode ends by itself at this time, zero for never, see setairdropend
     meme_t() {}
     meme_t(const name& i): applicant(i) {}
 
@@ -72,8 +85,39 @@ TBL meme_t {
 
     EOSLIB_SERIALIZE( meme_t,  (applicant)(total_supply)(coin_name)(quote_coin)(description)(icon_url)(media_urls)(whitepaper_url)
                                 (airdrop_ratio)(fee_ratio)(swap_sell_fee_ratio)(swap_sell_fee_receiver)
-                                (airdrop_enable)(issue_at)(swap_tradepair)(status)(created_at))
+                                (airdrop_enable)(issue_at)(swap_tradepair)(status)(created_at)(airdrop_end))
+};
+
+
+//scope: _self, paid memes until their launch is done, ordered by launch time
+TBL launch_t {
+    symbol                  sym;                                //PK
+    name                    issuer;                             //payer of the quote coin
+    time_point_sec          launch_at;                          //issue_at, or the payment time
+
+    uint64_t primary_key()const { return sym.code().raw(); }
+    uint64_t by_launch_at()const { return launch_at.sec_since_epoch(); }
+
+    typedef eosio::multi_index< "launchqueue"_n,  launch_t,
+        indexed_by<"bylaunchat"_n, const_mem_fun<launch_t, uint64_t, &launch_t::by_launch_at> >
+    > table;
+
+    EOSLIB_SERIALIZE( launch_t,  (sym)(issuer)(launch_at) )
 };
 
+//scope: _self, unpaid memes ordered by application time, erased by gcmemes after MEME_APPLY_TTL
+TBL pending_t {
+    symbol                  sym;                                //PK
+    time_point_sec          created_at;
+
+    uint64_t primary_key()const { return sym.code().raw(); }
+    uint64_t by_created_at()const { return created_at.sec_since_epoch(); }
+
+    typedef eosio::multi_index< "pendingmemes"_n,  pending_t,
+        indexed_by<"bycreatedat"_n, const_mem_fun<pending_t, uint64_t, &pending_t::by_created_at> >
+    > table;
+
+    EOSLIB_SERIALIZE( pending_t,  (sym)(created_at) )
+};
 
-} //namespace amax
\ No newline at end of file
+} //namespace amax
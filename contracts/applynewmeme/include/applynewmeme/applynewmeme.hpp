@@ -104,6 +104,45 @@ class [[eosio::contract("applynewmeme")]] applynewmeme : public contract {
 
    ACTION closeairdrop(const symbol& symbol);
 
+   /**
+    * Set the time airdrop mode of a meme ends by itself, applicant only, zero keeps it on until
+    * closeairdrop. It is stored on the meme and passed to meme.token at launch, or forwarded to
+    * meme.token if the token already exists. The airdropmeme row is only closed by closeairdrop.
+    */
+   ACTION setairdropend(const symbol& symbol, const time_point_sec& airdrop_end);
+
+   /**
+    * Run the next launch stage of a paid meme, see meme_status. Each stage sends a bounded
+    * set of inline actions, a failed stage leaves the status unchanged and can be retried.
+    * Anyone can push the launch forward, a scheduled meme once its issue_at has passed.
+    */
+   ACTION launchstep(const symbol& symbol);
+
+   /**
+    * Advance every meme whose launch time has come by one launch stage, at most `max_rows` memes,
+    * creating the token of a scheduled meme first. Anyone can call it as a crank.
+    */
+   ACTION processlaunch(const uint32_t& max_rows);
+
+   /**
+    * Move the queued launch of a meme to `launch_at`, admin only. A launch whose stage keeps failing
+    * is parked with a far future time so it no longer blocks processlaunch, its meme is kept and
+    * can be finished with launchstep or requeued later.
+    */
+   ACTION setlaunchat(const symbol& symbol, const time_point_sec& launch_at);
+
+   /**
+    * Erase at most `max_rows` applications left unpaid for `MEME_APPLY_TTL`, oldest first,
+    * refunding their RAM to the applicants and releasing their symbols. Anyone can call it.
+    */
+   ACTION gcmemes(const uint32_t& max_rows);
+
+   /**
+    * Erase the given applications left unpaid for `MEME_APPLY_TTL`, at most `MAX_GC_ROWS` of them.
+    * Covers applications made before pendingmemes existed, which gcmemes can not find. Anyone can call it.
+    */
+   ACTION gcapplies(const std::vector<symbol>& symbols);
+
    ACTION updatemedia(const symbol& symbol, const string& media_urls);
 
    ACTION applytruedex(const symbol& symbol);
@@ -111,7 +150,13 @@ class [[eosio::contract("applynewmeme")]] applynewmeme : public contract {
    ACTION addmcap(const symbol& symbol, const asset& threshold);
 
    private:
-      void _hootswap_create(const extended_asset& sell_ex_quant, const extended_asset& buy_ex_quant,
+      void _erase_pending(const symbol& symbol);
+      void _create_token(const meme_t& meme, const name& issuer);
+      name _launch_step(const meme_t& meme, const name& issuer);
+      bool _sort_pools(const extended_asset& sell_ex_quant, const extended_asset& buy_ex_quant,
+                       extended_asset& pool1, extended_asset& pool2);
+      void _hootswap_create(const extended_asset& sell_ex_quant, const extended_asset& buy_ex_quant);
+      void _hootswap_mint(const extended_asset& sell_ex_quant, const extended_asset& buy_ex_quant,
                         const int16_t& swap_sell_fee_ratio, const name& swap_sell_fee_receiver);
 
       uint64_t _rand(const name& user, const uint64_t& range);
@@ -26,7 +26,19 @@ namespace meme_token
 
         [[eosio::action]] void creatememe(
                     const name &issuer, const asset &maximum_supply, const bool& airdrop_mode,
-                    const name& fee_receiver, const uint64_t& fee_ratio);
+                    const name& fee_receiver, const uint64_t& fee_ratio, const bool& fee_burn);
+
+        struct distribution_param
+        {
+            name    to;
+            asset   quantity;
+        };
+
+        [[eosio::action]] void launch(const name &issuer, const asset &maximum_supply,
+                                      const bool &airdrop_mode, const name &fee_receiver, const uint64_t &fee_ratio,
+                                      const bool &fee_burn, const std::vector<name> &system_accounts,
+                                      const std::vector<distribution_param> &distribution,
+                                      const time_point_sec &airdrop_end);
 
         [[eosio::action]] void retire(const asset &quantity, const string &memo);
 
@@ -38,12 +50,14 @@ namespace meme_token
         [[eosio::action]] void notifypayfee(const name &from, const name &to, const name& fee_receiver, const asset &fee, const string &memo);
         [[eosio::action]] void open(const name &owner, const symbol &symbol, const name &ram_payer);
         [[eosio::action]] void closeairdrop(const symbol &symbol);
+        [[eosio::action]] void airdropend(const symbol &symbol, const time_point_sec &ended_at);
         [[eosio::action]] void close(const name &owner, const symbol &symbol);
         [[eosio::action]] void feeratio(const symbol &symbol, uint64_t fee_ratio);
         [[eosio::action]] void feereceiver(const symbol &symbol, const name &fee_receiver);
         [[eosio::action]] void minfee(const symbol &symbol, const asset &min_fee_quant);
         [[eosio::action]] void feeexempt(const symbol &symbol, const name &account, bool is_fee_exempted);
         [[eosio::action]] void setacctperms( std::vector<name>& acccouts, const symbol& symbol, const bool& is_fee_exempted, const bool& airdropmode_allow_transfer);
+        [[eosio::action]] void setsysaccts(const symbol &symbol, const std::vector<name> &accounts);
         static asset get_balance(const name &token_contract_account, const name &owner, const symbol_code &sym_code)
         {
             accounts accountstable(token_contract_account, owner.value);
@@ -51,23 +65,26 @@ namespace meme_token
             return ac.balance;
         }
         using creatememe_action = eosio::action_wrapper<"creatememe"_n, &xtoken::creatememe>;
+        using launch_action = eosio::action_wrapper<"launch"_n, &xtoken::launch>;
         using retire_action = eosio::action_wrapper<"retire"_n, &xtoken::retire>;
         using transfer_action = eosio::action_wrapper<"transfer"_n, &xtoken::transfer>;
         using notifypayfee_action = eosio::action_wrapper<"notifypayfee"_n, &xtoken::notifypayfee>;
         using open_action = eosio::action_wrapper<"open"_n, &xtoken::open>;
         using close_action = eosio::action_wrapper<"close"_n, &xtoken::close>;
         using closeairdrop_action = eosio::action_wrapper<"closeairdrop"_n, &xtoken::closeairdrop>;
+        using airdropend_action = eosio::action_wrapper<"airdropend"_n, &xtoken::airdropend>;
         using feeratio_action = eosio::action_wrapper<"feeratio"_n, &xtoken::feeratio>;
         using feereceiver_action = eosio::action_wrapper<"feereceiver"_n, &xtoken::feereceiver>;
         using minfee_action = eosio::action_wrapper<"minfee"_n, &xtoken::minfee>;
         using feewhitelist_action = eosio::action_wrapper<"feeexempt"_n, &xtoken::feeexempt>;
         using setacctperms_action = eosio::action_wrapper<"setacctperms"_n, &xtoken::setacctperms>;
+        using setsysaccts_action = eosio::action_wrapper<"setsysaccts"_n, &xtoken::setsysaccts>;
         
         struct [[eosio::table]] account
         {
             asset balance;
-            bool  is_frozen = false;
             bool  is_fee_exempted = false;
+            bool  airdropmode_allow_transfer = false;
 
             uint64_t primary_key() const { return balance.symbol.code().raw(); }
         };
@@ -184,6 +184,56 @@ asset asset_from_string(string_view from)
     return asset(amount.value, sym);
 }
 
+// days since 1970-01-01 of a proleptic gregorian date
+int64_t days_from_civil(int64_t y, uint32_t m, uint32_t d) {
+    y -= m <= 2;
+    const int64_t  era = (y >= 0 ? y : y - 399) / 400;
+    const uint32_t yoe = (uint32_t)(y - era * 400);
+    const uint32_t doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    const uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (int64_t)doe - 719468;
+}
+
+// number of days in month m (1-12) of year y, proleptic gregorian
+uint32_t days_in_month(int64_t y, uint32_t m) {
+    static constexpr uint8_t days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    bool leap = (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+    return days[m - 1] + (m == 2 && leap);
+}
+
+// parse 10-digit unix seconds, "YYYY-MM-DD" or "YYYY-MM-DDTHH:MM:SS" (UTC, optional trailing Z),
+// shorter digit strings such as "20240601" are rejected rather than read as 1970 seconds
+bool time_from_string(string_view s, time_point_sec& t) {
+    s = trim(s);
+    if (s.empty()) return false;
+    auto num = [&](size_t pos, size_t len, uint64_t& v) {
+        v = 0;
+        for (size_t i = pos; i < pos + len; i++) {
+            if (s[i] < '0' || s[i] > '9') return false;
+            v = v * 10 + (s[i] - '0');
+        }
+        return true;
+    };
+    uint64_t v = 0;
+    if (s.size() == 10 && num(0, s.size(), v)) {
+        if (v > std::numeric_limits<uint32_t>::max()) return false;
+        t = time_point_sec((uint32_t)v);
+        return true;
+    }
+
+    if (s.back() == 'Z') s.remove_suffix(1);
+    if (s.size() != 10 && s.size() != 19) return false;
+    uint64_t y, mo, d, h = 0, mi = 0, se = 0;
+    if (s[4] != '-' || s[7] != '-' || !num(0, 4, y) || !num(5, 2, mo) || !num(8, 2, d)) return false;
+    if (s.size() == 19) {
+        if ((s[10] != 'T' && s[10] != ' ') || s[13] != ':' || s[16] != ':') return false;
+        if (!num(11, 2, h) || !num(14, 2, mi) || !num(17, 2, se)) return false;
+    }
+    if (y < 1970 || y > 2105 || mo < 1 || mo > 12 || d < 1 || d > days_in_month(y, mo) || h > 23 || mi > 59 || se > 59) return false;
+    t = time_point_sec((uint32_t)(days_from_civil(y, mo, d) * 86400 + h * 3600 + mi * 60 + se));
+    return true;
+}
+
 uint128_t make128key(uint64_t a, uint64_t b) {
     uint128_t aa = a;
     uint128_t bb = b;
@@ -66,7 +66,15 @@ void applynewmeme::applymeme(
                      ){  
 
    require_auth( applicant );
+   auto now = time_point_sec(current_time_point());
    auto itr = _meme_tbl.find(meme_coin.symbol.code().raw());
+   //an expired application does not hold the symbol
+   if(itr != _meme_tbl.end() && itr->status == meme_status::INIT
+         && itr->created_at.sec_since_epoch() + MEME_APPLY_TTL <= now.sec_since_epoch()){
+      _erase_pending(itr->total_supply.quantity.symbol);
+      _meme_tbl.erase(itr);
+      itr = _meme_tbl.end();
+   }
    if(itr != _meme_tbl.end()){
       CHECKC(false, err::RECORD_NOT_FOUND, "meme already exists");
    }
@@ -91,6 +99,8 @@ void applynewmeme::applymeme(
    auto limit = _init_mcap_list_threshold.find(quote_coin.quantity.symbol);
    CHECKC(limit != _init_mcap_list_threshold.end(), err::RECORD_NOT_FOUND, "quote_coin not exists");
    CHECKC(quote_coin.quantity.amount >= limit->second.amount, err::PARAM_ERROR, "quote_coin amount invalid");
+   time_point_sec issue_time;
+   CHECKC(issue_at.empty() || time_from_string(issue_at, issue_time), err::PARAM_ERROR, "issue_at invalid:" + issue_at);
    _meme_tbl.emplace(applicant, [&](auto &m) {
       m.applicant             = applicant;
       m.total_supply          = extended_asset{meme_coin, _gstate.meme_token_contract};
@@ -105,10 +115,15 @@ void applynewmeme::applymeme(
       m.swap_sell_fee_ratio   = swap_sell_fee_ratio;
       m.swap_sell_fee_receiver= swap_sell_fee_receiver;
       m.airdrop_enable        = airdrop_mode_on;
-      m.status                = "init"_n;
+      m.status                = meme_status::INIT;
       m.swap_tradepair        = sympair;
       m.issue_at              = issue_at;
-      m.created_at            = current_time_point();
+      m.created_at            = now;
+   });
+   pending_t::table pendings(_self, _self.value);
+   pendings.emplace(applicant, [&](auto &p) {
+      p.sym          = meme_coin.symbol;
+      p.created_at   = now;
    });
 
 
@@ -127,6 +142,9 @@ void applynewmeme::on_transfer(const name& from, const name& to, const asset& qu
    auto symbol       = symbol_from_string(parts[1]);
    auto itr          = _meme_tbl.find(symbol.code().raw());
    CHECKC(itr != _meme_tbl.end(),   err::RECORD_NOT_FOUND, "meme not exists");  
+   CHECKC(itr->status == meme_status::INIT, err::STATUS_ERROR, "meme already paid");
+   CHECKC(itr->created_at.sec_since_epoch() + MEME_APPLY_TTL > current_time_point().sec_since_epoch(),
+          err::TIME_EXPIRED, "meme application expired");
    eosio::print("quantity: " + itr->total_supply.quantity.to_string() + "\n");
    eosio::print("precision: " + to_string(calc_precision(itr->total_supply.quantity.symbol.precision()))+ "\n");
    eosio::print("quantity: " + quantity.to_string() + "\n");
@@ -135,57 +153,214 @@ void applynewmeme::on_transfer(const name& from, const name& to, const asset& qu
    CHECKC(quantity == itr->quote_coin.quantity, err::PARAM_ERROR, "quantity invalid:" + quantity.to_string());
    CHECKC(from_bank == itr->quote_coin.contract, err::PARAM_ERROR, "from bank invalid:" + from_bank.to_string()); 
 
-   auto airdrop_amount  = itr->total_supply.quantity.amount * itr->airdrop_ratio / RATIO_BOOST;
-   auto airdrop_asset   = asset(airdrop_amount, itr->total_supply.quantity.symbol);
+   _erase_pending(itr->total_supply.quantity.symbol);
 
-   meme_token::xtoken::creatememe_action act(_gstate.meme_token_contract, {_self, meme_token::xtoken::active_permission});
-   act.send(from, itr->total_supply.quantity, itr->airdrop_enable, "oooo"_n, itr->fee_ratio);
-   eosio::print("creatememe end");
-   
-   //set set accout perms
-   meme_token::xtoken::setacctperms_action act_perm(_gstate.meme_token_contract, {_self, meme_token::xtoken::active_permission});
-   std::vector<name> acccouts = {_self, _gstate.airdrop_contract, _gstate.swap_contract, "amax.split"_n};
-   act_perm.send(acccouts, symbol, true, true);
-   
-   extended_asset sell_ex_quant  = extended_asset{ itr->total_supply.quantity - airdrop_asset, itr->total_supply.contract};
-   extended_asset buy_ex_quant   = extended_asset{quantity, from_bank};
-   _hootswap_create(sell_ex_quant, buy_ex_quant, itr->swap_sell_fee_ratio, itr->swap_sell_fee_receiver);
-   eosio::print("create_hootswap end");
+   //a meme paid before its issue_at is created by processlaunch when it is due
+   auto now          = time_point_sec(current_time_point());
+   auto launch_at    = now;
+   time_point_sec issue_time;
+   if(time_from_string(itr->issue_at, issue_time) && issue_time > now){
+      launch_at = issue_time;
+   } else {
+      _create_token(*itr, from);
+   }
+
+   //the liquidity and airdrop stages run in later processlaunch or launchstep actions
+   launch_t::table launches(_self, _self.value);
+   launches.emplace(_self, [&](auto &l) {
+      l.sym       = itr->total_supply.quantity.symbol;
+      l.issuer    = from;
+      l.launch_at = launch_at;
+   });
+   _meme_tbl.modify(itr, _self, [&](auto &m) {
+      m.status = launch_at > now ? meme_status::SCHEDULED : meme_status::POOL_CREATED;
+   });
+
+}
+
+void applynewmeme::gcmemes(const uint32_t& max_rows){
+   CHECKC(max_rows > 0 && max_rows <= MAX_GC_ROWS, err::OVERSIZED, "max_rows invalid, max: " + to_string(MAX_GC_ROWS));
+
+   pending_t::table pendings(_self, _self.value);
+   auto idx = pendings.get_index<"bycreatedat"_n>();
+   auto now = current_time_point().sec_since_epoch();
+   uint32_t rows = 0;
+   for (auto itr = idx.begin(); itr != idx.end() && itr->created_at.sec_since_epoch() + MEME_APPLY_TTL <= now
+                                && rows < max_rows; rows++) {
+      auto meme = _meme_tbl.find(itr->sym.code().raw());
+      if (meme != _meme_tbl.end() && meme->status == meme_status::INIT) {
+         _meme_tbl.erase(meme);
+      }
+      itr = idx.erase(itr);
+   }
+   CHECKC(rows > 0, err::NOT_STARTED, "no meme application expired");
+}
 
+void applynewmeme::gcapplies(const std::vector<symbol>& symbols){
+   CHECKC(symbols.size() > 0 && symbols.size() <= MAX_GC_ROWS, err::OVERSIZED, "symbols invalid, max: " + to_string(MAX_GC_ROWS));
+
+   auto now = current_time_point().sec_since_epoch();
+   for (const auto& sym : symbols) {
+      auto itr = _meme_tbl.find(sym.code().raw());
+      CHECKC(itr != _meme_tbl.end(), err::RECORD_NOT_FOUND, "meme not found: " + sym.code().to_string());
+      CHECKC(itr->status == meme_status::INIT, err::STATUS_ERROR, "meme already paid: " + sym.code().to_string());
+      CHECKC(itr->created_at.sec_since_epoch() + MEME_APPLY_TTL <= now, err::NOT_STARTED,
+             "meme application not expired: " + sym.code().to_string());
+
+      _meme_tbl.erase(itr);
+      _erase_pending(sym);
+   }
+}
+
+void applynewmeme::_erase_pending(const symbol& symbol){
+   pending_t::table pendings(_self, _self.value);
+   auto itr = pendings.find(symbol.code().raw());
+   if(itr != pendings.end()){
+      pendings.erase(itr);
+   }
+}
+
+//creates the hootswap pool in the same action, so nobody can take the pair once the token exists
+void applynewmeme::_create_token(const meme_t& meme, const name& issuer){
+   auto airdrop_amount  = meme.total_supply.quantity.amount * meme.airdrop_ratio / RATIO_BOOST;
+   auto airdrop_asset   = asset(airdrop_amount, meme.total_supply.quantity.symbol);
+   extended_asset sell_ex_quant  = extended_asset{ meme.total_supply.quantity - airdrop_asset, meme.total_supply.contract};
+
+   //create the token, set system accounts and credit the airdrop share in one action,
+   //the rest of the supply stays with this contract for the pool
+   std::vector<name> acccouts = {_self, _gstate.airdrop_contract, _gstate.swap_contract, "amax.split"_n};
+   std::vector<meme_token::xtoken::distribution_param> distribution;
    if(airdrop_asset.amount > 0){
-      TRANSFER(_gstate.meme_token_contract, _gstate.airdrop_contract, airdrop_asset, "init:" + itr->applicant.to_string());
-      eosio::print("transfer end");
-      meme::airdropmeme::setairdrop_action act_airdrop(_gstate.airdrop_contract, {_self, meme_token::xtoken::active_permission});
-      act_airdrop.send(itr->applicant, extended_asset{airdrop_asset, _gstate.meme_token_contract});
+      distribution.push_back({_gstate.airdrop_contract, airdrop_asset});
+   }
+   //the end time set by the applicant, a meme launched after it starts without airdrop mode
+   auto airdrop_end     = meme.airdrop_end.value_or();
+   auto airdrop_mode    = meme.airdrop_enable && (airdrop_end == time_point_sec() || airdrop_end > time_point_sec(current_time_point()));
+   meme_token::xtoken::launch_action act(_gstate.meme_token_contract, {_self, meme_token::xtoken::active_permission});
+   //fee_ratio of a meme is a burn tax
+   act.send(issuer, meme.total_supply.quantity, airdrop_mode, "oooo"_n, meme.fee_ratio, true, acccouts, distribution,
+            airdrop_mode ? airdrop_end : time_point_sec());
+
+   _hootswap_create(sell_ex_quant, meme.quote_coin);
+}
+
+void applynewmeme::launchstep(const symbol& symbol){
+   auto itr = _meme_tbl.find(symbol.code().raw());
+   CHECKC(itr != _meme_tbl.end(), err::RECORD_NOT_FOUND, "meme not found");
+   auto issuer = name();
+   if (itr->status == meme_status::SCHEDULED) {
+      //a scheduled meme is created by launchstep too once it is due, e.g. after being parked
+      launch_t::table launches(_self, _self.value);
+      auto launch = launches.find(symbol.code().raw());
+      CHECKC(launch != launches.end(), err::RECORD_NOT_FOUND, "launch not found");
+      time_point_sec issue_time;
+      CHECKC(!time_from_string(itr->issue_at, issue_time) || issue_time <= time_point_sec(current_time_point()),
+             err::NOT_STARTED, "meme is not due yet");
+      issuer = launch->issuer;
    }
 
+   auto status = _launch_step(*itr, issuer);
    _meme_tbl.modify(itr, _self, [&](auto &m) {
-      m.status = "applied"_n;
+      m.status = status;
+   });
+}
+
+void applynewmeme::processlaunch(const uint32_t& max_rows){
+   CHECKC(max_rows > 0 && max_rows <= MAX_LAUNCH_ROWS, err::OVERSIZED, "max_rows invalid, max: " + to_string(MAX_LAUNCH_ROWS));
+
+   launch_t::table launches(_self, _self.value);
+   auto idx = launches.get_index<"bylaunchat"_n>();
+   auto now = time_point_sec(current_time_point());
+   uint32_t rows = 0;
+   for (auto itr = idx.begin(); itr != idx.end() && itr->launch_at <= now && rows < max_rows; rows++) {
+      auto meme = _meme_tbl.find(itr->sym.code().raw());
+      //a cleared meme leaves nothing to launch
+      if (meme == _meme_tbl.end() || meme->status == meme_status::INIT || meme->status == meme_status::DONE) {
+         itr = idx.erase(itr);
+         continue;
+      }
+      auto status = _launch_step(*meme, itr->issuer);
+      _meme_tbl.modify(meme, _self, [&](auto &m) {
+         m.status = status;
+      });
+      if (status == meme_status::DONE) {
+         itr = idx.erase(itr);
+      } else {
+         itr++;
+      }
+   }
+   CHECKC(rows > 0, err::NOT_STARTED, "no launch is due");
+}
+
+void applynewmeme::setlaunchat(const symbol& symbol, const time_point_sec& launch_at){
+   CHECKC(has_auth(_self) || has_auth(_gstate.admin), err::NO_AUTH, "no auth for setlaunchat");
+
+   launch_t::table launches(_self, _self.value);
+   auto itr = launches.find(symbol.code().raw());
+   CHECKC(itr != launches.end(), err::RECORD_NOT_FOUND, "launch not found");
+   launches.modify(itr, same_payer, [&](auto &l) {
+      l.launch_at = launch_at;
    });
+}
 
+name applynewmeme::_launch_step(const meme_t& meme, const name& issuer){
+   auto airdrop_amount  = meme.total_supply.quantity.amount * meme.airdrop_ratio / RATIO_BOOST;
+   auto airdrop_asset   = asset(airdrop_amount, meme.total_supply.quantity.symbol);
+   extended_asset sell_ex_quant  = extended_asset{ meme.total_supply.quantity - airdrop_asset, meme.total_supply.contract};
+   extended_asset buy_ex_quant   = meme.quote_coin;
+
+   auto status = meme.status;
+   if (status == meme_status::SCHEDULED) {
+      _create_token(meme, issuer);
+      status = meme_status::POOL_CREATED;
+   } else if (status == meme_status::POOL_CREATED) {
+      _hootswap_mint(sell_ex_quant, buy_ex_quant, meme.swap_sell_fee_ratio, meme.swap_sell_fee_receiver);
+      status = meme_status::LIQUIDITY_ADDED;
+   } else if (status == meme_status::LIQUIDITY_ADDED) {
+      //the airdrop share was credited by xtoken::launch
+      if(airdrop_asset.amount > 0){
+         meme::airdropmeme::setairdrop_action act_airdrop(_gstate.airdrop_contract, {_self, meme_token::xtoken::active_permission});
+         act_airdrop.send(meme.applicant, extended_asset{airdrop_asset, _gstate.meme_token_contract});
+      }
+      status = meme_status::DONE;
+   } else {
+      CHECKC(false, err::STATUS_ERROR, "meme is not launching, status: " + status.to_string());
+   }
+   return status;
 }
 
-void applynewmeme::_hootswap_create(const extended_asset& sell_ex_quant, const extended_asset& buy_ex_quant,
-      const int16_t& swap_sell_fee_ratio, const name& swap_sell_fee_receiver
-      ){
-   auto from   = _self;
-   auto pool1  = sell_ex_quant;
-   auto pool2  = buy_ex_quant;
-   auto is_sell_coin_symbol_left = true;
+bool applynewmeme::_sort_pools(const extended_asset& sell_ex_quant, const extended_asset& buy_ex_quant,
+                               extended_asset& pool1, extended_asset& pool2){
+   pool1  = sell_ex_quant;
+   pool2  = buy_ex_quant;
    if (pool1.quantity.symbol.code().to_string() > pool2.quantity.symbol.code().to_string()) {
       pool1          = buy_ex_quant;
       pool2          = sell_ex_quant;
-      is_sell_coin_symbol_left = false;
+      return false;
    }
+   return true;
+}
+
+void applynewmeme::_hootswap_create(const extended_asset& sell_ex_quant, const extended_asset& buy_ex_quant){
+   extended_asset pool1, pool2;
+   _sort_pools(sell_ex_quant, buy_ex_quant, pool1, pool2);
 
    bool is_exists = amax::hootswap::is_exists_pool(_gstate.swap_contract, pool1.get_extended_symbol(), pool2.get_extended_symbol());
    CHECKC(!is_exists, err::RECORD_EXISTING, "pool already exists");
 
-   auto sympair   = amax::hootswap::pool_symbol(pool1.quantity.symbol, pool2.quantity.symbol);
    auto liquidity_symbol_string = add_symbol(pool1.quantity.symbol, pool2.quantity.symbol, 1);
    CREATEHOOTSWAP(_gstate.swap_contract,
              _self, pool1.get_extended_symbol(), pool2.get_extended_symbol(), 
              symbol_code(liquidity_symbol_string))
+}
+
+void applynewmeme::_hootswap_mint(const extended_asset& sell_ex_quant, const extended_asset& buy_ex_quant,
+      const int16_t& swap_sell_fee_ratio, const name& swap_sell_fee_receiver
+      ){
+   auto from   = _self;
+   extended_asset pool1, pool2;
+   auto is_sell_coin_symbol_left = _sort_pools(sell_ex_quant, buy_ex_quant, pool1, pool2);
+   auto sympair   = amax::hootswap::pool_symbol(pool1.quantity.symbol, pool2.quantity.symbol);
 
    TOKEN_TRANSFER(pool1.contract,
                   _gstate.swap_contract,
@@ -221,11 +396,32 @@ void applynewmeme::closeairdrop(const symbol& symbol){
    //meme.token can transfer 
    meme_token::xtoken::closeairdrop_action act(_gstate.meme_token_contract, {_self, meme_token::xtoken::active_permission});
    act.send(symbol);
-   //airdrop close airdrop 
+   //airdrop close airdrop, when airdrop mode expires by itself instead the airdropmeme row stays "init"
+   //and its owner keeps handing out the airdrop share, the airdrop contract is a system account
    meme::airdropmeme::closeairdrop_action act2(_gstate.airdrop_contract, {_self, meme_token::xtoken::active_permission});
    act2.send(symbol);
 }
 
+void applynewmeme::setairdropend(const symbol& symbol, const time_point_sec& airdrop_end){
+   auto itr = _meme_tbl.find(symbol.code().raw());
+   CHECKC(itr != _meme_tbl.end(), err::RECORD_NOT_FOUND, "meme not found");
+   require_auth(itr->applicant);
+
+   CHECKC(itr->airdrop_enable, err::PARAM_ERROR, "airdrop not enable");
+   CHECKC(airdrop_end == time_point_sec() || airdrop_end > time_point_sec(current_time_point()), err::PARAM_ERROR,
+          "airdrop end must be in the future");
+
+   _meme_tbl.modify(itr, _self, [&](auto &m) {
+      m.airdrop_end = airdrop_end;
+   });
+
+   //the token exists from poolcreated on
+   if (itr->status != meme_status::INIT && itr->status != meme_status::SCHEDULED) {
+      meme_token::xtoken::airdropend_action act(_gstate.meme_token_contract, {_self, meme_token::xtoken::active_permission});
+      act.send(symbol, airdrop_end);
+   }
+}
+
 void applynewmeme::updatemedia(const symbol& symbol, const string& media_urls){
    auto itr = _meme_tbl.find(symbol.code().raw());
    CHECKC(itr != _meme_tbl.end(), err::RECORD_NOT_FOUND, "meme not found"); 
@@ -249,7 +445,7 @@ void applynewmeme::applytruedex(const symbol& symbol){
    auto itr = _meme_tbl.find(symbol.code().raw());
    CHECKC(itr != _meme_tbl.end(), err::RECORD_NOT_FOUND, "meme not found"); 
 
-   CHECKC(itr->status == "init"_n, err::PARAM_ERROR, "meme status invalid");
+   CHECKC(itr->status == meme_status::INIT, err::PARAM_ERROR, "meme status invalid");
    auto quote_symbol    = itr->quote_coin.quantity.symbol;
    auto market_limit    = _gstate.mcap_list_threshold[quote_symbol];
    uint64_t current_price = 0;
@@ -303,6 +499,12 @@ void applynewmeme::clearmeme(const symbol& symbol){
    if(itr != _meme_tbl.end()){
       _meme_tbl.erase(itr);
    }
+   _erase_pending(symbol);
+   launch_t::table launches(_self, _self.value);
+   auto launch = launches.find(symbol.code().raw());
+   if(launch != launches.end()){
+      launches.erase(launch);
+   }
 }
 
 
@@ -1,16 +1,48 @@
 #pragma once
 
 #include <eosio/asset.hpp>
+#include <eosio/binary_extension.hpp>
 #include <eosio/eosio.hpp>
 #include <eosio/singleton.hpp>
+#include <eosio/system.hpp>
+#include <algorithm>
+#include <map>
+#include <set>
 #include <string>
 
+#ifndef MEME_TOKEN_FEE_POLICY
+#define MEME_TOKEN_FEE_POLICY 1
+#endif
+#ifndef MEME_TOKEN_AIRDROP_POLICY
+#define MEME_TOKEN_AIRDROP_POLICY 1
+#endif
+#ifndef MEME_TOKEN_REFLECTION_POLICY
+#define MEME_TOKEN_REFLECTION_POLICY 1
+#endif
+
 namespace meme_token
 {
 
     using std::string;
     using namespace eosio;
 
+    /**
+     * Compile-time policies of the transfer core, each build variant in CMakeLists.txt sets them with
+     * the MEME_TOKEN_*_POLICY definitions. The paths of a disabled policy are not compiled into the wasm
+     * and its setters reject turning it on. The variants are selected by the macros only, the transfer
+     * core reads token_policy directly.
+     *
+     * A build without reflection ignores reflect_index: balances are read as stored, so deploying it over
+     * tokens that had reflection on drops their holders' unsettled rewards. A build without fees or the
+     * airdrop gate rejects transfers of tokens with `fee_ratio > 0` or in airdrop mode instead.
+     */
+    struct token_policy
+    {
+        static constexpr bool fee           = MEME_TOKEN_FEE_POLICY;            // fee ratio, burn, accrual
+        static constexpr bool airdrop_gate  = MEME_TOKEN_AIRDROP_POLICY;        // airdrop mode transfer gate
+        static constexpr bool reflection    = MEME_TOKEN_REFLECTION_POLICY && MEME_TOKEN_FEE_POLICY;
+    };
+
     /**
      * The `meme.token` sample system contract defines the structures and actions that allow users to create, issue, and manage tokens for AMAX based blockchains. It demonstrates one way to implement a smart contract which allows for creation and management of tokens. It is possible for one to create a similar contract which suits different needs. However, it is recommended that if one only needs a token with the below listed actions, that one uses the `meme.token` contract instead of developing their own.
      *
@@ -27,6 +59,14 @@ namespace meme_token
         using contract::contract;
 
         static constexpr uint64_t RATIO_BOOST = 10000;
+        static constexpr uint64_t HOLDER_SHARDS = 16;
+        static constexpr uint64_t MAX_SWEEP_ROWS = 100;
+        static constexpr uint64_t MAX_DISTRIBUTION_ROWS = 100;
+        static constexpr uint64_t MAX_MIGRATE_ROWS = 100;
+        static constexpr uint64_t MAX_SYSTEM_ACCOUNTS = 8;
+        static constexpr uint128_t REFLECT_SCALE = 1000000000000;   // initial reflect_index
+        static constexpr size_t MAX_BALANCE_POINTS = 64;
+        static constexpr size_t MAX_QUERY_TOKENS = 100;
 
          static constexpr eosio::name active_permission{"active"_n};
          xtoken(name receiver, name code, datastream<const char *> ds)
@@ -35,6 +75,7 @@ namespace meme_token
         {
             _gstate = _gstate_tbl.exists() ? _gstate_tbl.get() : global{};
         }
+        ~xtoken() { flush_stats(); }
         [[eosio::action]] void init(const name &admin, 
                                     const name &applynewmeme_contract){
             require_auth(get_self());
@@ -46,7 +87,29 @@ namespace meme_token
 
         [[eosio::action]] void creatememe(
                     const name &issuer, const asset &maximum_supply, 
-                    const bool& airdrop_mode, const name& fee_receiver, const uint64_t& fee_ratio);
+                    const bool& airdrop_mode, const name& fee_receiver, const uint64_t& fee_ratio,
+                    const bool& fee_burn);
+
+        struct distribution_param
+        {
+            name    to;
+            asset   quantity;
+        };
+
+        /**
+         * Create a meme like `creatememe`, set its system accounts like `setsysaccts` and credit its
+         * supply in one action. Each `distribution` entry is credited directly, without a transfer,
+         * the rest of `maximum_supply` goes to applynewmeme_contract.
+         *
+         * @param system_accounts - the system accounts of the token, at most `MAX_SYSTEM_ACCOUNTS`,
+         * @param distribution - the initial balances, at most `MAX_DISTRIBUTION_ROWS`,
+         * @param airdrop_end - the time airdrop mode ends by itself, see `airdropend`, zero for never.
+         */
+        [[eosio::action]] void launch(const name &issuer, const asset &maximum_supply,
+                                      const bool &airdrop_mode, const name &fee_receiver, const uint64_t &fee_ratio,
+                                      const bool &fee_burn, const std::vector<name> &system_accounts,
+                                      const std::vector<distribution_param> &distribution,
+                                      const time_point_sec &airdrop_end);
 
         /**
          * The opposite for create action, if all validations succeed,
@@ -71,9 +134,53 @@ namespace meme_token
                                         const asset &quantity,
                                         const string &memo);
 
+        struct transfer_param
+        {
+            name    to;
+            asset   quantity;
+            string  memo;
+        };
+
+        /**
+         * Allows `from` account to transfer to many `to` accounts, tokens of several symbols may be mixed.
+         * Each transfer follows the same fee and airdrop mode rules as `transfer`, the stats and the
+         * `from` balance of every symbol are loaded once and `from` is debited once per symbol.
+         * Recipients are notified of this action, not of `transfer`.
+         *
+         * @param from - the account to transfer from,
+         * @param transfers - the recipients, quantities and memos.
+         */
+        [[eosio::action]] void transferbatch(const name &from, const std::vector<transfer_param> &transfers);
+
+        /**
+         * Allow `spender` to transfer up to `quantity` tokens of `owner` with `transferfrom`,
+         * replacing the previous allowance of the symbol, a zero quantity removes it.
+         *
+         * @param owner - the account whose tokens can be spent, pays the RAM of the allowance,
+         * @param spender - the account allowed to spend them,
+         * @param quantity - the allowance.
+         */
+        [[eosio::action]] void approve(const name &owner, const name &spender, const asset &quantity);
+
+        /**
+         * Transfer `quantity` tokens of `from` to `to` on behalf of `spender`, consuming the allowance
+         * `from` gave to `spender`. The fee and airdrop mode rules of `transfer` apply to `from`, so a
+         * contract can pull a deposit in one inline action instead of handling a transfer memo.
+         * `spender` pays the RAM of the rows the transfer creates, the `from` row keeps its payer.
+         *
+         * @param spender - the account spending the allowance,
+         * @param from - the account to transfer from,
+         * @param to - the account to be transferred to,
+         * @param quantity - the quantity of tokens to be transferred,
+         * @param memo - the memo string to accompany the transaction.
+         */
+        [[eosio::action]] void transferfrom(const name &spender, const name &from, const name &to,
+                                            const asset &quantity, const string &memo);
+
         /**
          * Notify pay fee.
-         * Must be Triggered as inline action by transfer()
+         * No longer sent by transfer(), transfer fees accrue per symbol and are
+         * collected by `claimfees`. Kept for ABI compatibility.
          *
          * @param from - the from account of transfer(),
          * @param to - the to account of transfer, fee payer,
@@ -84,6 +191,40 @@ namespace meme_token
          */
         [[eosio::action]] void notifypayfee(const name &from, const name &to, const name& fee_receiver, const asset &fee, const string &memo);
 
+        /**
+         * Credit the transfer fees accrued for each symbol to its `fee_receiver`.
+         * Anyone may call it, the fee receiver is notified.
+         *
+         * @param symbols - the symbols of the tokens to claim fees for.
+         */
+        [[eosio::action]] void claimfees(const std::vector<symbol> &symbols);
+
+        /**
+         * Sweep dust balances of a token: rows of `owners` holding less than `threshold` are erased and
+         * their balances retired from supply, or credited to the fee receiver when `to` is set.
+         * `threshold` is at most `min_fee_quant` plus one unit, only balances `transfer` can not move are dust.
+         * Rows of the issuer, the fee receiver and accounts with fee exemption or airdrop mode permission are kept.
+         * The issuer pages through holders off-chain, at most `MAX_SWEEP_ROWS` owners per call.
+         *
+         * @param symbol - the symbol of the token.
+         * @param owners - the accounts to sweep.
+         * @param threshold - balances below it are swept, at most `min_fee_quant` plus one unit.
+         * @param to - empty to retire the swept balances, or the fee receiver of the token.
+         */
+        [[eosio::action]] void sweepdust(const symbol &symbol, const std::vector<name> &owners, const asset &threshold, const name &to);
+
+        /**
+         * Choose which notifications `account` receives from this contract.
+         * Without a setting an account is notified of its transfers and not of fees, a contract
+         * that does not handle `on_notify` can turn transfer notifications off to save CPU.
+         * Fee notifications are folded into the taxed transfer, the fee receiver is notified of it.
+         *
+         * @param account - the account to set notifications for, pays the RAM of the setting.
+         * @param transfer_notify - notify `account` of transfers it sends or receives.
+         * @param fee_notify - notify `account` of transfers paying fees to it as fee receiver.
+         */
+        [[eosio::action]] void setnotify(const name &account, const bool &transfer_notify, const bool &fee_notify);
+
         /**
          * Allows `ram_payer` to create an account `owner` with zero balance for
          * token `symbol` at the expense of `ram_payer`.
@@ -109,6 +250,15 @@ namespace meme_token
 
         [[eosio::action]] void closeairdrop(const symbol &symbol);
 
+        /**
+         * Set the time airdrop mode of a token ends by itself, `transfer` compares it with the block time
+         * so no action is needed when it passes. `closeairdrop` still ends the mode early.
+         *
+         * @param symbol - the symbol of the token,
+         * @param ended_at - the end time, zero keeps airdrop mode on until `closeairdrop`.
+         */
+        [[eosio::action]] void airdropend(const symbol &symbol, const time_point_sec &ended_at);
+
         /**
          * Set token fee ratio
          *
@@ -126,6 +276,147 @@ namespace meme_token
          */
         [[eosio::action]] void feereceiver(const symbol &symbol, const name &fee_receiver);
 
+        /**
+         * Set token fee burn mode
+         * In burn mode the transfer fee is retired from supply instead of being accrued for the fee receiver.
+         *
+         * @param symbol - the symbol of the token.
+         * @param fee_burn - burn transfer fees.
+         */
+        [[eosio::action]] void feeburn(const symbol &symbol, const bool &fee_burn);
+
+        /**
+         * Set token auto reclaim mode
+         * In auto reclaim mode an account row emptied by transfer or retire is erased and its RAM released,
+         * rows with fee exemption or airdrop mode permission are kept.
+         *
+         * @param symbol - the symbol of the token.
+         * @param auto_reclaim - erase emptied account rows.
+         */
+        [[eosio::action]] void autoreclaim(const symbol &symbol, const bool &auto_reclaim);
+
+        /**
+         * Set token reflection mode
+         * In reflection mode the transfer fee is shared by all holders in proportion to their balances.
+         * It costs O(1): the fee grows a balance index in the stats row, each account row is settled
+         * against it the next time it is written, `get_balance` includes the unsettled part.
+         * System accounts take no share, their balances stay out of the index.
+         * It cannot be turned on while the holder index is kept.
+         *
+         * @param symbol - the symbol of the token.
+         * @param reflection - share transfer fees with holders.
+         */
+        [[eosio::action]] void reflection(const symbol &symbol, const bool &reflection);
+
+        /**
+         * Set token holder index mode
+         * In holder index mode the `holders` table scoped by the symbol keeps every account with a positive
+         * balance, its `bybalance` index pages holders from the largest balance. Rows are updated with the
+         * balance, holders from before the index was enabled show up when their balance next changes.
+         * A token that ever had reflection on cannot keep it: rewards grow balances without writing their rows.
+         *
+         * @param symbol - the symbol of the token.
+         * @param holder_index - keep the holders table.
+         */
+        [[eosio::action]] void holderindex(const symbol &symbol, const bool &holder_index);
+
+        /**
+         * Set token balance history mode
+         * In history mode every balance change appends a checkpoint for the account, at most one per block,
+         * so `balanceat` can answer for any moment after history was last enabled.
+         *
+         * @param symbol - the symbol of the token.
+         * @param history - keep balance checkpoints.
+         */
+        [[eosio::action]] void keephistory(const symbol &symbol, const bool &history);
+
+        /**
+         * Read-only, balance of `owner` as of the block at or before `at`, from its balance checkpoints.
+         * Reflection rewards not settled at that time are not included.
+         *
+         * @param owner - the account.
+         * @param symbol - the symbol of the token.
+         * @param at - the moment to query.
+         */
+        [[eosio::action]] asset balanceat(const name &owner, const symbol &symbol, const time_point_sec &at);
+
+        // metrics counters of a token, kept in rows the write path changes anyway
+        struct metric_counters
+        {
+            uint64_t    transfers           = 0;
+            int64_t     volume              = 0;        // transferred, fees included
+            int64_t     fees                = 0;        // charged by transfers, whether accrued, burned or reflected
+            int64_t     retired             = 0;
+            uint64_t    peak_holders        = 0;        // highest holder count reconciled by syncholders
+
+            void add(const uint64_t &count, const asset &quantity, const asset &fee) {
+                transfers   += count;
+                volume      += quantity.amount;
+                fees        += fee.amount;
+            }
+            void add(const metric_counters &c) {
+                transfers   += c.transfers;
+                volume      += c.volume;
+                fees        += c.fees;
+                retired     += c.retired;
+            }
+        };
+
+        struct token_metrics
+        {
+            asset           volume;
+            uint64_t        transfers           = 0;
+            asset           fees;
+            asset           retired;
+            uint64_t        peak_holders        = 0;
+        };
+
+        /**
+         * Set token metrics mode
+         * In metrics mode the token counts transfers, volume, fees and retired quantity without writing a
+         * row of its own: a taxed transfer counts in the fee accrual or stats row its fee already writes,
+         * `retire` in the stats row, an untaxed transfer in the holder shard of the sender.
+         * The peak holder count is sampled by `syncholders`, a peak between two syncs is not seen.
+         *
+         * @param symbol - the symbol of the token.
+         * @param metrics - keep the metrics row.
+         */
+        [[eosio::action]] void keepmetrics(const symbol &symbol, const bool &metrics);
+
+        /**
+         * Read-only, the metrics of a token.
+         *
+         * @param sym_code - the symbol code of the token.
+         */
+        [[eosio::action]] token_metrics getmetrics(const symbol_code &sym_code);
+
+        /**
+         * Read-only, all balances of `owner`, one per token in its `accounts` scope, as returned by `get_balance`.
+         *
+         * @param owner - the account.
+         */
+        [[eosio::action]] std::vector<asset> getbalances(const name &owner);
+
+        struct token_info
+        {
+            asset       supply;
+            asset       max_supply;
+            name        issuer;
+            uint64_t    fee_ratio;
+            name        fee_receiver;
+            asset       min_fee_quant;
+            bool        fee_burn;
+            bool        reflection;
+            bool        airdrop_mode;
+        };
+
+        /**
+         * Read-only, supply and fee parameters of each token in `sym_codes`.
+         *
+         * @param sym_codes - the symbol codes of the tokens.
+         */
+        [[eosio::action]] std::vector<token_info> gettokens(const std::vector<symbol_code> &sym_codes);
+
         /**
          * Set token min fee quantity
          *
@@ -150,6 +441,34 @@ namespace meme_token
          */
         [[eosio::action]] void setacctperms( std::vector<name>& acccouts, const symbol& symbol, const bool& is_fee_exempted, const bool& airdropmode_allow_transfer);
 
+        /**
+         * Fold the pending holder count shards of a token into `total_accounts`.
+         * Transfers only touch a shard row when the number of holders changes,
+         * anyone may call this to reconcile the count kept in the stats row.
+         *
+         * @param symbol - the symbol of the token.
+         */
+        [[eosio::action]] void syncholders(const symbol &symbol);
+
+        /**
+         * Upgrade the stats row of `symbol` and at most `MAX_MIGRATE_ROWS` of its account rows to the current
+         * layout. Rows are upgraded lazily when they are written, this finishes the rest in bounded batches.
+         * A token created before the registry is registered here.
+         * `owners` lists the accounts to upgrade, the admin pages them off-chain from the account scopes.
+         * The holders table is no source for them: a row enters it only when written, which already upgrades it.
+         */
+        [[eosio::action]] void migraterows(const symbol &symbol, const std::vector<name> &owners);
+
+        /**
+         * Set the system accounts of a token, at most `MAX_SYSTEM_ACCOUNTS`.
+         * They are fee exempted and allowed to transfer in airdrop mode like accounts
+         * set by `setacctperms`, but the permission lives in the stats row, no account row is created.
+         *
+         * @param symbol - the symbol of the token.
+         * @param accounts - the system accounts, replaces the current list.
+         */
+        [[eosio::action]] void setsysaccts(const symbol &symbol, const std::vector<name> &accounts);
+
         static asset get_supply(const name &token_contract_account, const symbol_code &sym_code)
         {
             stats statstable(token_contract_account, sym_code.raw());
@@ -157,24 +476,100 @@ namespace meme_token
             return st.supply;
         }
 
+        /**
+         * Balance of `owner`, including unsettled reflection rewards, and for the fee receiver the fees not claimed yet.
+         */
         static asset get_balance(const name &token_contract_account, const name &owner, const symbol_code &sym_code)
         {
             accounts accountstable(token_contract_account, owner.value);
-            const auto &ac = accountstable.get(sym_code.raw());
-            return ac.balance;
+            auto ac = accountstable.find(sym_code.raw());
+            stats statstable(token_contract_account, sym_code.raw());
+            const auto &st = statstable.get(sym_code.raw());
+            if (owner == st.fee_receiver) {
+                fee_accruals accruals(token_contract_account, sym_code.raw());
+                auto fa = accruals.find(sym_code.raw());
+                if (fa != accruals.end()) {
+                    return (ac != accountstable.end() ? st.balance_of(owner, *ac) : asset(0, st.supply.symbol)) + fa->accrued;
+                }
+            }
+            check(ac != accountstable.end(), "unable to find key");
+            return st.balance_of(owner, *ac);
+        }
+        /**
+         * Balance of `owner` as of `at`, binary searched in its balance checkpoints.
+         * Only moments since history was last enabled are known. Without checkpoints the balance never
+         * changed since then, so it is the current one.
+         */
+        static asset get_balance_at(const name &token_contract_account, const name &owner, const symbol &sym,
+                                    const time_point_sec &at)
+        {
+            stats statstable(token_contract_account, sym.code().raw());
+            const auto &st = statstable.get(sym.code().raw(), "token of symbol does not exist");
+            check(st.history.value_or(), "balance history is off");
+            check(at >= st.history_since.value_or(), "no balance history before it was enabled");
+            balance_histories histories(token_contract_account, owner.value);
+            auto hi = histories.find(sym.code().raw());
+            if (hi == histories.end() || hi->points.back().at < block_timestamp(st.history_since.value_or())) {
+                accounts accountstable(token_contract_account, owner.value);
+                auto ac = accountstable.find(sym.code().raw());
+                if (ac == accountstable.end()) return asset(0, sym);
+                return st.balance_of(owner, *ac);
+            }
+            const auto &h = *hi;
+            auto slot = block_timestamp(at);
+            auto itr = std::upper_bound(h.points.begin(), h.points.end(), slot,
+                [](const block_timestamp &t, const balance_point &p) { return t < p.at; });
+            if (itr == h.points.begin()) return asset(0, h.sym);
+            return asset((itr - 1)->amount, h.sym);
+        }
+
+        /**
+         * Holder count of a token, including the shard deltas not yet folded by `syncholders`.
+         */
+        static uint64_t get_holders(const name &token_contract_account, const symbol_code &sym_code)
+        {
+            stats statstable(token_contract_account, sym_code.raw());
+            const auto &st = statstable.get(sym_code.raw());
+            int64_t total = st.total_accounts;
+            holder_shards shards(token_contract_account, sym_code.raw());
+            for (const auto &h : shards) {
+                total += h.delta;
+            }
+            return total;
         }
         void setacctperms(const name& issuer, const name& to, const symbol& symbol,  const bool& airdropmode_allow_transfer);
 
         using creatememe_action = eosio::action_wrapper<"creatememe"_n, &xtoken::creatememe>;
+        using launch_action = eosio::action_wrapper<"launch"_n, &xtoken::launch>;
         using retire_action = eosio::action_wrapper<"retire"_n, &xtoken::retire>;
         using transfer_action = eosio::action_wrapper<"transfer"_n, &xtoken::transfer>;
+        using transferbatch_action = eosio::action_wrapper<"transferbatch"_n, &xtoken::transferbatch>;
+        using approve_action = eosio::action_wrapper<"approve"_n, &xtoken::approve>;
+        using transferfrom_action = eosio::action_wrapper<"transferfrom"_n, &xtoken::transferfrom>;
         using notifypayfee_action = eosio::action_wrapper<"notifypayfee"_n, &xtoken::notifypayfee>;
         using open_action = eosio::action_wrapper<"open"_n, &xtoken::open>;
         using close_action = eosio::action_wrapper<"close"_n, &xtoken::close>;
+        using airdropend_action = eosio::action_wrapper<"airdropend"_n, &xtoken::airdropend>;
         using feeratio_action = eosio::action_wrapper<"feeratio"_n, &xtoken::feeratio>;
         using feereceiver_action = eosio::action_wrapper<"feereceiver"_n, &xtoken::feereceiver>;
+        using feeburn_action = eosio::action_wrapper<"feeburn"_n, &xtoken::feeburn>;
+        using autoreclaim_action = eosio::action_wrapper<"autoreclaim"_n, &xtoken::autoreclaim>;
+        using reflection_action = eosio::action_wrapper<"reflection"_n, &xtoken::reflection>;
+        using holderindex_action = eosio::action_wrapper<"holderindex"_n, &xtoken::holderindex>;
+        using keephistory_action = eosio::action_wrapper<"keephistory"_n, &xtoken::keephistory>;
+        using balanceat_action = eosio::action_wrapper<"balanceat"_n, &xtoken::balanceat>;
+        using keepmetrics_action = eosio::action_wrapper<"keepmetrics"_n, &xtoken::keepmetrics>;
+        using getmetrics_action = eosio::action_wrapper<"getmetrics"_n, &xtoken::getmetrics>;
+        using getbalances_action = eosio::action_wrapper<"getbalances"_n, &xtoken::getbalances>;
+        using gettokens_action = eosio::action_wrapper<"gettokens"_n, &xtoken::gettokens>;
         using minfee_action = eosio::action_wrapper<"minfee"_n, &xtoken::minfee>;
         using feewhitelist_action = eosio::action_wrapper<"feeexempt"_n, &xtoken::feeexempt>;
+        using claimfees_action = eosio::action_wrapper<"claimfees"_n, &xtoken::claimfees>;
+        using setnotify_action = eosio::action_wrapper<"setnotify"_n, &xtoken::setnotify>;
+        using sweepdust_action = eosio::action_wrapper<"sweepdust"_n, &xtoken::sweepdust>;
+        using setsysaccts_action = eosio::action_wrapper<"setsysaccts"_n, &xtoken::setsysaccts>;
+        using syncholders_action = eosio::action_wrapper<"syncholders"_n, &xtoken::syncholders>;
+        using migraterows_action = eosio::action_wrapper<"migraterows"_n, &xtoken::migraterows>;
 
     private:
         
@@ -184,13 +579,32 @@ namespace meme_token
         };
         typedef eosio::singleton< "global"_n, global > global_table;
 
-        //scope: account.value 
+        // row layout versions, a row older than these is upgraded on its next write or by migraterows
+        static constexpr uint8_t ACCOUNT_VERSION = 1;          // 1: version tag present
+        static constexpr uint8_t STATS_VERSION = 5;            // 1: all extensions present, 2: airdrop_end, 3: counters,
+                                                               // 4: reflect_pending, 5: history_since
+
+        //scope: account.value
+        //`balance` misses unsettled reflection rewards, `get_balance` or `getbalances` include them
         struct [[eosio::table]] account
         {
             asset    balance;
             bool     is_fee_exempted            = false;
             bool     airdropmode_allow_transfer     = false;        //是否允许发送, 如果允许就不收手续费
+            eosio::binary_extension<uint8_t> version;                   // ACCOUNT_VERSION once upgraded
+            eosio::binary_extension<uint128_t> reflect_checkpoint;      // currency_stats::reflect_index at the last settlement
+
             uint64_t primary_key() const { return balance.symbol.code().raw(); }
+
+            // extensions are serialized in order, fill the missing ones before setting a later one
+            void upgrade() {
+                if (version.value_or() >= ACCOUNT_VERSION) return;
+                version = ACCOUNT_VERSION;
+            }
+            void set_checkpoint(const uint128_t &index) {
+                upgrade();
+                reflect_checkpoint = index;
+            }
         };
         
         //scope: get_self()
@@ -202,14 +616,177 @@ namespace meme_token
             uint64_t    fee_ratio           = 0;        // fee ratio, boost 10000
             name        fee_receiver = "oooo"_n;      // fee receiver
             asset       min_fee_quant;               // min fee quantity
-            uint64_t    total_accounts      = 0;   
+            uint64_t    total_accounts      = 0;        // holder count as of the last syncholders
             bool        airdrop_mode        = false;
+            eosio::binary_extension<bool> fee_burn;     // retire transfer fees from supply
+            eosio::binary_extension<bool> auto_reclaim; // erase account rows emptied by a debit
+            eosio::binary_extension<std::vector<name>> system_accounts; // fee exempted and allowed in airdrop mode, no account row needed
+            eosio::binary_extension<bool> reflection;   // share transfer fees with all holders
+            eosio::binary_extension<uint128_t> reflect_index; // growth of holder balances, 0 until reflection is first enabled
+            eosio::binary_extension<bool> holder_index; // keep the holders table of the symbol
+            eosio::binary_extension<bool> history;      // keep balance checkpoints for balanceat
+            eosio::binary_extension<bool> metrics;      // keep metric_counters, see keepmetrics
+            eosio::binary_extension<uint8_t> version;   // STATS_VERSION once upgraded
+            eosio::binary_extension<time_point_sec> airdrop_end;  // airdrop mode ends by itself at this time, zero for never
+            eosio::binary_extension<metric_counters> counters;    // taxed transfers in burn or reflection mode, retire, peak
+            eosio::binary_extension<int64_t> reflect_pending;     // reflected fees in supply the index could not express yet
+            eosio::binary_extension<time_point_sec> history_since; // when history was last enabled
 
             uint64_t primary_key() const { return supply.symbol.code().raw(); }
+
+            // extensions are serialized in order, fill the missing ones before setting a later one
+            void upgrade() {
+                if (version.value_or() >= STATS_VERSION) return;
+                if (!fee_burn.has_value())          fee_burn.emplace(false);
+                if (!auto_reclaim.has_value())      auto_reclaim.emplace(false);
+                if (!system_accounts.has_value())   system_accounts.emplace();
+                if (!reflection.has_value())        reflection.emplace(false);
+                if (!reflect_index.has_value())     reflect_index.emplace(0);
+                if (!holder_index.has_value())      holder_index.emplace(false);
+                if (!history.has_value())           history.emplace(false);
+                if (!metrics.has_value())           metrics.emplace(false);
+                version = STATS_VERSION;
+                if (!airdrop_end.has_value())       airdrop_end.emplace();
+                if (!counters.has_value())          counters.emplace();
+                if (!reflect_pending.has_value())   reflect_pending.emplace(0);
+                if (!history_since.has_value())     history_since.emplace();
+            }
+
+            // balance of `acct` of `owner` including the reflection rewards not settled into the row yet,
+            // system accounts take no rewards
+            asset balance_of(const name &owner, const account &acct) const {
+                if constexpr (!token_policy::reflection) return acct.balance;
+                auto index = reflect_index.value_or();
+                if (index == 0 || is_system_account(owner)) return acct.balance;
+                auto checkpoint = acct.reflect_checkpoint.has_value() ? acct.reflect_checkpoint.value() : REFLECT_SCALE;
+                if (checkpoint == index) return acct.balance;
+                uint128_t amount = (uint128_t)acct.balance.amount * index / checkpoint;
+                check(amount <= std::numeric_limits<int64_t>::max(), "reflection balance overflow");
+                return asset((int64_t)amount, acct.balance.symbol);
+            }
+
+            // settle the rewards of a row that is being written
+            void settle(const name &owner, account &acct) const {
+                if constexpr (!token_policy::reflection) return;
+                auto index = reflect_index.value_or();
+                if (index == 0) return;
+                acct.balance = balance_of(owner, acct);
+                acct.set_checkpoint(index);
+            }
+
+            bool in_airdrop_mode() const {
+                if (!airdrop_mode) return false;
+                auto end = airdrop_end.value_or();
+                return end == time_point_sec() || time_point_sec(current_time_point()) < end;
+            }
+
+            bool is_system_account(const name &account) const {
+                if (!system_accounts.has_value()) return false;
+                const auto &accts = system_accounts.value();
+                return std::find(accts.begin(), accts.end(), account) != accts.end();
+            }
+        };
+
+        //scope: symbol code, pending holder count changes spread over `HOLDER_SHARDS` rows
+        struct [[eosio::table]] holder_shard
+        {
+            uint64_t    id;                         // account.value % HOLDER_SHARDS
+            int64_t     delta               = 0;    // not yet folded into currency_stats.total_accounts
+            metric_counters counters;               // untaxed transfers of senders in this shard
+
+            uint64_t primary_key() const { return id; }
+        };
+
+        enum notify_event : uint8_t {
+            NOTIFY_TRANSFER     = 1 << 0,
+            NOTIFY_FEE          = 1 << 1,
+        };
+        static constexpr uint8_t DEFAULT_NOTIFY = NOTIFY_TRANSFER;
+
+        //scope: get_self(), accounts without a row get DEFAULT_NOTIFY
+        struct [[eosio::table]] notify_pref
+        {
+            name        account;
+            uint8_t     events              = DEFAULT_NOTIFY;  // notify_event bits
+
+            uint64_t primary_key() const { return account.value; }
+        };
+
+        //scope: symbol code, transfer fees waiting to be claimed by fee_receiver
+        struct [[eosio::table]] fee_accrual
+        {
+            asset       accrued;
+            metric_counters counters;               // taxed transfers in accrual mode
+
+            uint64_t primary_key() const { return accrued.symbol.code().raw(); }
+        };
+
+        struct balance_point
+        {
+            block_timestamp at;
+            int64_t         amount;
+        };
+
+        //scope: account.value, balance after the last change in each block, oldest first,
+        //the older half is thinned out when there are more than MAX_BALANCE_POINTS
+        struct [[eosio::table]] balance_history
+        {
+            symbol                      sym;
+            std::vector<balance_point>  points;
+
+            uint64_t primary_key() const { return sym.code().raw(); }
+        };
+
+        //scope: owner.value, one row per spender and symbol
+        struct [[eosio::table]] allowance
+        {
+            uint64_t    id;
+            name        spender;
+            asset       quantity;                   // left to spend
+
+            uint64_t primary_key() const { return id; }
+            uint128_t by_spender() const { return (uint128_t)spender.value << 64 | quantity.symbol.code().raw(); }
+        };
+
+        //scope: symbol code, one row per account holding a positive balance
+        struct [[eosio::table]] holder
+        {
+            name        owner;
+            asset       balance;                    // settled balance, see currency_stats::balance_of
+
+            uint64_t primary_key() const { return owner.value; }
+            // iterates from the largest balance
+            uint64_t by_balance() const { return std::numeric_limits<uint64_t>::max() - (uint64_t)balance.amount; }
         };
 
         typedef eosio::multi_index<"accounts"_n, account> accounts;
         typedef eosio::multi_index<"stat"_n, currency_stats> stats;
+        typedef eosio::multi_index<"holdershards"_n, holder_shard> holder_shards;
+        typedef eosio::multi_index<"feeaccruals"_n, fee_accrual> fee_accruals;
+        typedef eosio::multi_index<"notifyprefs"_n, notify_pref> notify_prefs;
+        typedef eosio::multi_index<"balhistory"_n, balance_history> balance_histories;
+        //scope: get_self(), one row per token created by creatememe, pages all tokens without walking scopes
+        struct [[eosio::table]] token_entry
+        {
+            symbol          sym;
+            name            issuer;
+            time_point_sec  created_at;             // registration time for tokens created before the registry
+
+            uint64_t primary_key() const { return sym.code().raw(); }
+            uint64_t by_issuer() const { return issuer.value; }
+            uint64_t by_created() const { return created_at.sec_since_epoch(); }
+        };
+
+        typedef eosio::multi_index<"tokens"_n, token_entry,
+            indexed_by<"byissuer"_n, const_mem_fun<token_entry, uint64_t, &token_entry::by_issuer>>,
+            indexed_by<"bycreated"_n, const_mem_fun<token_entry, uint64_t, &token_entry::by_created>>
+        > token_registry;
+        typedef eosio::multi_index<"allowances"_n, allowance,
+            indexed_by<"byspender"_n, const_mem_fun<allowance, uint128_t, &allowance::by_spender>>
+        > allowances;
+        typedef eosio::multi_index<"holders"_n, holder,
+            indexed_by<"bybalance"_n, const_mem_fun<holder, uint64_t, &holder::by_balance>>
+        > holders;
 
         template <typename Field, typename Value>
         void update_currency_field(const symbol &symbol, const Value &v, Field currency_stats::*field,
@@ -220,8 +797,52 @@ namespace meme_token
         bool add_balance(const currency_stats &st, const name &owner, const asset &value,
                          const name &ram_payer, bool is_check_frozen = false);
 
+        asset credit_transfer(const currency_stats &st, const account &from_acct, const name &from,
+                              const name &to, const asset &quantity, const string &memo, const name &ram_payer,
+                              int64_t &add_count);
+        // charges `fee` and adds `counters` to the row the fee writes, false if no row took them
+        bool pay_fee(currency_stats &st, const asset &fee, const metric_counters *counters);
+
+        // in-place variants on an already loaded row, used by the transfer path
+        bool sub_balance(const currency_stats &st, accounts &accts, const account &acct, const asset &value,
+                         const name &ram_payer);
+        bool add_balance(const currency_stats &st, accounts &accts, accounts::const_iterator &itr, const name &owner,
+                         const asset &value, const name &ram_payer);
+
+
+        // holders and history rows are billed to their owner when it signs, to this contract otherwise
+        void balance_changed(const currency_stats &st, const name &owner, const asset &before, const asset &after);
+        void record_balance(const currency_stats &st, const name &owner, const asset &before, const asset &after);
+        void update_holder(const currency_stats &st, const name &owner, const asset &balance);
+        void notify(const name &account, notify_event event);
+        void accrue_fee(const uint64_t &sym_code_raw, const asset &fee, const metric_counters *counters);
+        bool settle_fees(const currency_stats &st);
+        void add_holders(const uint64_t &sym_code_raw, const name &account, const int64_t &delta,
+                         const metric_counters *counters = nullptr);
+        void upgrade_account(const name &owner, const uint64_t &sym_code_raw);
+        void register_token(const currency_stats &st);
+
+        // action-local row caches: repeated lookups share one multi_index instance per scope, and the
+        // stats rows changed through `stats_changed` are written back once when the action ends.
+        // Account rows are not buffered, each balance change is written through, so a recipient repeated
+        // in `transferbatch` is modified once per entry: the RAM payer, holders and history updates are
+        // decided at the write.
+        struct cached_stats
+        {
+            stats           table;
+            currency_stats  row;
+            bool            dirty               = false;
+
+            cached_stats(const name &code, const uint64_t &scope): table(code, scope) {}
+        };
+        currency_stats &get_stats(const uint64_t &sym_code_raw, const char *error_msg);
+        void stats_changed(const currency_stats &st);
+        void flush_stats();
+        accounts &get_accounts(const name &owner);
 
         bool open_account(const name &owner, const symbol &symbol, const name &ram_payer);
+        void _transfer(const name &from, const name &to, const asset &quantity, const string &memo,
+                       const name &ram_payer);
 
         inline void require_issuer(const name& issuer, const symbol& sym) {
             stats statstable( get_self(), sym.code().raw() );
@@ -230,11 +851,19 @@ namespace meme_token
             const auto& st = *existing;
             check( issuer == st.issuer, "can only be executed by issuer account" );
         }
+        void check_system_accounts(const std::vector<name> &accounts);
+        void _create_meme(const name &issuer, const asset &maximum_supply, const bool &airdrop_mode,
+                          const name &fee_receiver, const uint64_t &fee_ratio, const bool &fee_burn,
+                          const std::vector<name> &system_accounts, const time_point_sec &airdrop_end,
+                          const uint64_t &total_accounts);
         void _add_balance( const name &owner, const asset &value, const name &ram_payer);
 
         void _add_whitelist(const name &owner, const symbol &symbol, const name &ram_payer);
         global_table _gstate_tbl;
         global _gstate;
+        std::map<uint64_t, cached_stats> _stats_cache;
+        std::map<uint64_t, accounts> _accounts_cache;
+        std::map<uint64_t, uint8_t> _notify_cache;     // notify_event bits by account
     };
 
 }
@@ -25,11 +25,7 @@ namespace meme_token {
         check(sym.is_valid(), "invalid symbol name");
         check(memo.size() <= 256, "memo has more than 256 bytes");
 
-        stats statstable(get_self(), sym_code_raw);
-        auto existing = statstable.find(sym_code_raw);
-        check(existing != statstable.end(), "token with symbol does not exist");
-        const auto &st = *existing;
-
+        auto &st = get_stats(sym_code_raw, "token with symbol does not exist");
         require_auth(st.issuer);
 
         check(quantity.is_valid(), "invalid quantity");
@@ -39,14 +35,19 @@ namespace meme_token {
 
         auto add_count = 0;
 
+        // the fee receiver spends what get_balance reports, unclaimed fees included
+        if (st.issuer == st.fee_receiver) settle_fees(st);
         if(sub_balance(st, st.issuer, quantity)) {
             add_count = -1;
         }
 
-        statstable.modify(st, same_payer, [&](auto &s)
-                          { s.supply -= quantity; 
-                            s.total_accounts += add_count; });
-
+        st.supply -= quantity;
+        st.total_accounts += add_count;
+        if (st.metrics.value_or()) {
+            st.upgrade();
+            st.counters.value().retired += quantity.amount;
+        }
+        stats_changed(st);
     }
 
     void xtoken::transfer(const name    &from,
@@ -54,76 +55,306 @@ namespace meme_token {
                           const asset   &quantity,
                           const string  &memo)
     {
-        check(from != to, "cannot transfer to self");
         require_auth(from);
-        check(is_account(to), "to account does not exist");
+        _transfer(from, to, quantity, memo, from);
+    }
+
+    void xtoken::_transfer(const name &from, const name &to, const asset &quantity, const string &memo,
+                           const name &ram_payer)
+    {
+        auto sym_code_raw = quantity.symbol.code().raw();
+        auto &st = get_stats(sym_code_raw, "token of symbol does not exist");
+
+        notify(from, NOTIFY_TRANSFER);
+        // the fee receiver spends what get_balance reports, unclaimed fees included
+        if (from == st.fee_receiver) settle_fees(st);
+
+        // every account row is looked up exactly once and the iterators are
+        // carried through debit and credit below
+        auto &from_accts = get_accounts(from);
+        const auto &from_acct = from_accts.get(sym_code_raw, "no balance object found");
+
+        int64_t add_count = 0;
+        auto fee = credit_transfer(st, from_acct, from, to, quantity, memo, ram_payer, add_count);
+        if(sub_balance(st, from_accts, from_acct, quantity, ram_payer)) {
+            add_count -= 1;
+        }
+        // the counters ride on a row this transfer writes anyway, an untaxed one counts in a holder shard
+        metric_counters counters;
+        counters.add(1, quantity, fee);
+        auto metered = st.metrics.value_or();
+        auto counted = pay_fee(st, fee, metered ? &counters : nullptr);
+        if (add_count != 0 || (metered && !counted)) {
+            add_holders(sym_code_raw, add_count > 0 ? to : from, add_count, metered && !counted ? &counters : nullptr);
+        }
+    }
+
+    void xtoken::transferbatch(const name &from, const std::vector<transfer_param> &transfers)
+    {
+        require_auth(from);
+        check(transfers.size() > 0, "transfers is empty");
+        notify(from, NOTIFY_TRANSFER);
+
+        // one pass per symbol: stats and the sender row are loaded once and the
+        // sender is debited with a single modify for all transfers of the symbol
+        std::set<uint64_t> done;
+        for (size_t i = 0; i < transfers.size(); i++) {
+            auto sym_code_raw = transfers[i].quantity.symbol.code().raw();
+            if (!done.insert(sym_code_raw).second) continue;
+
+            auto &st = get_stats(sym_code_raw, "token of symbol does not exist");
+            if (from == st.fee_receiver) settle_fees(st);
+            auto &from_accts = get_accounts(from);
+            const auto &from_acct = from_accts.get(sym_code_raw, "no balance object found");
+
+            int64_t add_count = 0;
+            uint64_t count = 0;
+            asset total = asset(0, st.supply.symbol);
+            asset fees = asset(0, st.supply.symbol);
+            for (size_t j = i; j < transfers.size(); j++) {
+                const auto &t = transfers[j];
+                if (t.quantity.symbol.code().raw() != sym_code_raw) continue;
+                fees += credit_transfer(st, from_acct, from, t.to, t.quantity, t.memo, from, add_count);
+                total += t.quantity;
+                count++;
+            }
+            if(sub_balance(st, from_accts, from_acct, total, from)) {
+                add_count -= 1;
+            }
+            metric_counters counters;
+            counters.add(count, total, fees);
+            auto metered = st.metrics.value_or();
+            auto counted = pay_fee(st, fees, metered ? &counters : nullptr);
+            if (add_count != 0 || (metered && !counted)) {
+                add_holders(sym_code_raw, from, add_count, metered && !counted ? &counters : nullptr);
+            }
+        }
+    }
+
+    void xtoken::approve(const name &owner, const name &spender, const asset &quantity)
+    {
+        require_auth(owner);
+        check(owner != spender, "cannot approve to self");
+        check(is_account(spender), "spender account does not exist");
         auto sym_code_raw = quantity.symbol.code().raw();
         stats statstable(get_self(), sym_code_raw);
         const auto &st = statstable.get(sym_code_raw, "token of symbol does not exist");
         check(st.supply.symbol == quantity.symbol, "symbol precision mismatch");
+        check(quantity.is_valid(), "invalid quantity");
+        check(quantity.amount >= 0, "must approve non-negative quantity");
 
-        require_recipient(from);
-        require_recipient(to);
+        allowances allows(get_self(), owner.value);
+        auto idx = allows.get_index<"byspender"_n>();
+        auto itr = idx.find((uint128_t)spender.value << 64 | sym_code_raw);
+        if (quantity.amount == 0) {
+            if (itr != idx.end()) idx.erase(itr);
+        } else if (itr == idx.end()) {
+            allows.emplace(owner, [&](auto &a) {
+                a.id        = allows.available_primary_key();
+                a.spender   = spender;
+                a.quantity  = quantity;
+            });
+        } else {
+            idx.modify(itr, same_payer, [&](auto &a) {
+                a.quantity  = quantity;
+            });
+        }
+    }
+
+    void xtoken::transferfrom(const name &spender, const name &from, const name &to,
+                              const asset &quantity, const string &memo)
+    {
+        require_auth(spender);
+        allowances allows(get_self(), from.value);
+        auto idx = allows.get_index<"byspender"_n>();
+        auto itr = idx.find((uint128_t)spender.value << 64 | quantity.symbol.code().raw());
+        check(itr != idx.end(), "no allowance of " + from.to_string() + " to spender");
+        check(itr->quantity.symbol == quantity.symbol, "symbol precision mismatch");
+        check(itr->quantity.amount >= quantity.amount, "overdrawn allowance");
+        if (itr->quantity.amount == quantity.amount) {
+            idx.erase(itr);
+        } else {
+            idx.modify(itr, same_payer, [&](auto &a) {
+                a.quantity -= quantity;
+            });
+        }
+        _transfer(from, to, quantity, memo, spender);
+    }
 
+    asset xtoken::credit_transfer(const currency_stats &st, const account &from_acct, const name &from,
+                                  const name &to, const asset &quantity, const string &memo, const name &ram_payer,
+                                  int64_t &add_count)
+    {
+        check(from != to, "cannot transfer to self");
+        check(st.supply.symbol == quantity.symbol, "symbol precision mismatch");
         check(quantity.is_valid(), "invalid quantity");
         check(quantity.amount > 0, "must transfer positive quantity");
-        check(quantity.symbol == st.supply.symbol, "symbol precision mismatch");
         check(memo.size() <= 256, "memo has more than 256 bytes");
 
-        CHECK(quantity > st.min_fee_quant, "quantity must larger than min fee:" + st.min_fee_quant.to_string());
-        accounts from_accts(get_self(), from.value);
-        auto from_acct = from_accts.find(sym_code_raw);
-        accounts to_accts(get_self(), to.value);
-        auto to_acct = to_accts.find(sym_code_raw);
-        if(st.airdrop_mode) {
-            auto from_flag = from_acct->airdropmode_allow_transfer;
-            auto to_flag = to_acct != to_accts.end() ? to_acct->airdropmode_allow_transfer : false;
-            check(from_flag | to_flag, "from account and to account is not allow send in airdrop mode: " + from.to_string() + " -> " + to.to_string());
+        // a build without a policy refuses tokens that rely on it instead of silently dropping it
+        if constexpr (token_policy::fee) {
+            CHECK(quantity > st.min_fee_quant, "quantity must larger than min fee:" + st.min_fee_quant.to_string());
+        } else {
+            check(st.fee_ratio == 0, "token charges fees, not supported by this build");
+        }
+        if constexpr (!token_policy::airdrop_gate) {
+            check(!st.in_airdrop_mode(), "token is in airdrop mode, not supported by this build");
         }
 
-        bool fee_exempt = true;
-        if(from_acct != from_accts.end()) {
-            fee_exempt = from_acct->is_fee_exempted; 
+        notify(to, NOTIFY_TRANSFER);
+
+        auto sym_code_raw = quantity.symbol.code().raw();
+        auto &to_accts = get_accounts(to);
+        auto to_acct = to_accts.find(sym_code_raw);
+        bool to_exists = to_acct != to_accts.end();
+        // an existing balance row implies an existing account
+        if (!to_exists) check(is_account(to), "to account does not exist");
+
+        if constexpr (token_policy::airdrop_gate) {
+            if(st.in_airdrop_mode() && !st.is_system_account(from) && !st.is_system_account(to)) {
+                auto to_flag = to_exists ? to_acct->airdropmode_allow_transfer : false;
+                check(from_acct.airdropmode_allow_transfer | to_flag, "from account and to account is not allow send in airdrop mode: " + from.to_string() + " -> " + to.to_string());
+            }
         }
 
-        fee_exempt = fee_exempt | ( to_acct != to_accts.end() && to_acct->is_fee_exempted);
-    
         asset actual_recv = quantity;
         asset fee = asset(0, quantity.symbol);
-        if (    st.fee_receiver.value != 0
-            &&  st.fee_ratio > 0
-            &&  to != st.issuer
-            &&  to != st.fee_receiver )
-        {
-            if(!fee_exempt) {
-                fee.amount = std::max( st.min_fee_quant.amount,
-                                (int64_t)multiply_decimal64(quantity.amount, st.fee_ratio, RATIO_BOOST) );
-                CHECK(fee < quantity, "the calculated fee must less than quantity");
-                actual_recv -= fee;
+        if constexpr (token_policy::fee) {
+            if (    (st.fee_receiver.value != 0 || st.fee_burn.value_or() || st.reflection.value_or())
+                &&  st.fee_ratio > 0
+                &&  to != st.issuer
+                &&  to != st.fee_receiver )
+            {
+                bool fee_exempt =   from_acct.is_fee_exempted || ( to_exists && to_acct->is_fee_exempted )
+                                ||  st.is_system_account(from) || st.is_system_account(to);
+                if(!fee_exempt) {
+                    fee.amount = std::max( st.min_fee_quant.amount,
+                                    (int64_t)multiply_decimal64(quantity.amount, st.fee_ratio, RATIO_BOOST) );
+                    CHECK(fee < quantity, "the calculated fee must less than quantity");
+                    actual_recv -= fee;
+                }
             }
         }
 
-        auto payer = has_auth(to) ? to : from;
-
-        auto add_count = 0;
-        if(sub_balance(st, from, quantity, true)) {
-            add_count = -1;
-        }
-        if(add_balance(st, to, actual_recv, payer, true)) {
+        auto payer = has_auth(to) ? to : ram_payer;
+        if(add_balance(st, to_accts, to_acct, to, actual_recv, payer)) {
             add_count += 1;
         }
+        return fee;
+    }
 
-        if (fee.amount > 0) {
-            if(fee.amount > 0) {
-                if(add_balance(st, st.fee_receiver, fee, payer)) {
-                    add_count += 1;
+    bool xtoken::pay_fee(currency_stats &st, const asset &fee, const metric_counters *counters)
+    {
+        if constexpr (!token_policy::fee) return false;
+        if (fee.amount == 0) return false;
+
+        // the stats row is written back anyway in burn and reflection mode
+        auto count = [&]() {
+            if (counters == nullptr) return;
+            st.upgrade();
+            st.counters.value().add(*counters);
+        };
+        if constexpr (token_policy::reflection) {
+            if (st.reflection.value_or()) {
+                // system accounts keep their balances, the other holders now own supply - excluded - fee,
+                // grow their balances back to supply - excluded
+                int64_t excluded = 0;
+                for (const auto &owner : st.system_accounts.value_or()) {
+                    const auto &accts = get_accounts(owner);
+                    auto itr = accts.find(st.supply.symbol.code().raw());
+                    if (itr != accts.end()) excluded += itr->balance.amount;
+                }
+                // the holders now own `held`, the fee and the remainder earlier fees left undistributed are
+                // shared, what the truncated index does not express is carried to the next fee
+                auto pending = st.reflect_pending.value_or();
+                auto held = st.supply.amount - excluded - pending - fee.amount;
+                if (held > 0) {
+                    auto shared = fee.amount + pending;
+                    uint128_t index = st.reflect_index.value();
+                    uint128_t total = (uint128_t)held + shared;
+                    check(index <= std::numeric_limits<uint128_t>::max() / total, "reflection index overflow");
+                    uint128_t grown = index * total / held;
+                    auto distributed = (int64_t)((uint128_t)held * (grown - index) / index);
+                    st.upgrade();
+                    st.reflect_index = grown;
+                    st.reflect_pending = shared - distributed;
+                    count();
+                    stats_changed(st);
+                    return true;
                 }
-                notifypayfee_action notifypayfee_act{ get_self(), { {get_self(), active_permission} } };
-                notifypayfee_act.send( from, to, st.fee_receiver, fee, memo );
+                // no holder left to share the fee, it is burned or accrued below
             }
         }
-        statstable.modify(st, same_payer, [&](auto &s)
-                          { s.total_accounts += add_count; });
+        if (st.fee_burn.value_or()) {
+            st.supply -= fee;
+            count();
+            stats_changed(st);
+        } else {
+            // collected by fee_receiver later through claimfees()
+            accrue_fee(st.supply.symbol.code().raw(), fee, counters);
+            notify(st.fee_receiver, NOTIFY_FEE);
+        }
+        return true;
+    }
+
+    void xtoken::setnotify(const name &account, const bool &transfer_notify, const bool &fee_notify) {
+        require_auth(account);
+
+        uint8_t events = (transfer_notify ? NOTIFY_TRANSFER : 0) | (fee_notify ? NOTIFY_FEE : 0);
+        notify_prefs prefs(get_self(), get_self().value);
+        auto itr = prefs.find(account.value);
+        if (events == DEFAULT_NOTIFY) {
+            if (itr != prefs.end()) prefs.erase(itr);
+        } else if (itr == prefs.end()) {
+            prefs.emplace(account, [&](auto &p) {
+                p.account   = account;
+                p.events    = events;
+            });
+        } else {
+            prefs.modify(itr, account, [&](auto &p) {
+                p.events    = events;
+            });
+        }
+    }
+
+    void xtoken::notify(const name &account, notify_event event) {
+        auto cached = _notify_cache.find(account.value);
+        if (cached == _notify_cache.end()) {
+            notify_prefs prefs(get_self(), get_self().value);
+            auto itr = prefs.find(account.value);
+            cached = _notify_cache.emplace(account.value, itr != prefs.end() ? itr->events : DEFAULT_NOTIFY).first;
+        }
+        if (cached->second & event) require_recipient(account);
+    }
+
+    xtoken::currency_stats &xtoken::get_stats(const uint64_t &sym_code_raw, const char *error_msg) {
+        auto itr = _stats_cache.find(sym_code_raw);
+        if (itr == _stats_cache.end()) {
+            itr = _stats_cache.try_emplace(sym_code_raw, get_self(), sym_code_raw).first;
+            itr->second.row = itr->second.table.get(sym_code_raw, error_msg);
+        }
+        return itr->second.row;
+    }
+
+    void xtoken::stats_changed(const currency_stats &st) {
+        auto itr = _stats_cache.find(st.supply.symbol.code().raw());
+        check(itr != _stats_cache.end() && &itr->second.row == &st, "stats row is not cached");
+        itr->second.dirty = true;
+    }
+
+    void xtoken::flush_stats() {
+        for (auto &[sym_code_raw, cached] : _stats_cache) {
+            if (!cached.dirty) continue;
+            cached.table.modify(cached.table.get(sym_code_raw), same_payer, [&](auto &s) {
+                s = cached.row;
+                s.upgrade();
+            });
+            cached.dirty = false;
+        }
+    }
+
+    xtoken::accounts &xtoken::get_accounts(const name &owner) {
+        return _accounts_cache.try_emplace(owner.value, get_self(), owner.value).first->second;
     }
 
     /**
@@ -143,46 +374,330 @@ namespace meme_token {
         require_recipient(fee_receiver);
     }
 
+    void xtoken::migraterows(const symbol &symbol, const std::vector<name> &owners) {
+        require_auth(_gstate.admin);
+        auto sym_code_raw = symbol.code().raw();
+        stats statstable(get_self(), sym_code_raw);
+        const auto &st = statstable.get(sym_code_raw, "token of symbol does not exist");
+        check(st.supply.symbol == symbol, "symbol precision mismatch");
+        check(owners.size() <= MAX_MIGRATE_ROWS, "too many owners, max: " + std::to_string(MAX_MIGRATE_ROWS));
+
+        if (st.version.value_or() < STATS_VERSION) {
+            statstable.modify(st, same_payer, [&](auto &s) {
+                s.upgrade();
+            });
+        }
+        register_token(st);
+
+        for (const auto &owner : owners) {
+            upgrade_account(owner, sym_code_raw);
+        }
+    }
+
+    void xtoken::upgrade_account(const name &owner, const uint64_t &sym_code_raw) {
+        auto &accts = get_accounts(owner);
+        auto itr = accts.find(sym_code_raw);
+        if (itr == accts.end() || itr->version.value_or() >= ACCOUNT_VERSION) return;
+        // the balance is not settled, holders and history rows stay valid
+        accts.modify(itr, same_payer, [&](auto &a) {
+            a.upgrade();
+        });
+    }
+
+    void xtoken::register_token(const currency_stats &st) {
+        token_registry registry(get_self(), get_self().value);
+        if (registry.find(st.supply.symbol.code().raw()) != registry.end()) return;
+        registry.emplace(get_self(), [&](auto &t) {
+            t.sym           = st.supply.symbol;
+            t.issuer        = st.issuer;
+            t.created_at    = current_time_point();
+        });
+    }
+
+    void xtoken::syncholders(const symbol &symbol) {
+        auto sym_code_raw = symbol.code().raw();
+        stats statstable(get_self(), sym_code_raw);
+        const auto &st = statstable.get(sym_code_raw, "token of symbol does not exist");
+        check(st.supply.symbol == symbol, "symbol precision mismatch");
+
+        int64_t delta = 0;
+        holder_shards shards(get_self(), sym_code_raw);
+        for (auto itr = shards.begin(); itr != shards.end(); itr++) {
+            if (itr->delta == 0) continue;
+            delta += itr->delta;
+            shards.modify(itr, same_payer, [&](auto &h) {
+                h.delta = 0;
+            });
+        }
+        check(delta != 0, "holder count already in sync");
+        statstable.modify(st, same_payer, [&](auto &s) {
+            s.upgrade();
+            s.total_accounts += delta;
+            // the peak is sampled when the count is reconciled
+            if (s.metrics.value() && s.counters.value().peak_holders < s.total_accounts) {
+                s.counters.value().peak_holders = s.total_accounts;
+            }
+        });
+    }
+
+    void xtoken::add_holders(const uint64_t &sym_code_raw, const name &account, const int64_t &delta,
+                             const metric_counters *counters) {
+        holder_shards shards(get_self(), sym_code_raw);
+        auto id = account.value % HOLDER_SHARDS;
+        auto itr = shards.find(id);
+        if (itr == shards.end()) {
+            shards.emplace(get_self(), [&](auto &h) {
+                h.id    = id;
+                h.delta = delta;
+                if (counters != nullptr) h.counters.add(*counters);
+            });
+        } else {
+            shards.modify(itr, same_payer, [&](auto &h) {
+                h.delta += delta;
+                if (counters != nullptr) h.counters.add(*counters);
+            });
+        }
+    }
+
+    void xtoken::claimfees(const std::vector<symbol> &symbols) {
+        check(symbols.size() > 0, "symbols is empty");
+        for (const auto &symbol : symbols) {
+            auto sym_code_raw = symbol.code().raw();
+            stats statstable(get_self(), sym_code_raw);
+            const auto &st = statstable.get(sym_code_raw, "token of symbol does not exist");
+            check(st.supply.symbol == symbol, "symbol precision mismatch");
+            check(settle_fees(st), "no fees to claim: " + symbol.code().to_string());
+        }
+    }
+
+    void xtoken::sweepdust(const symbol &symbol, const std::vector<name> &owners, const asset &threshold, const name &to) {
+        auto sym_code_raw = symbol.code().raw();
+        stats statstable(get_self(), sym_code_raw);
+        const auto &st = statstable.get(sym_code_raw, "token of symbol does not exist");
+        check(st.supply.symbol == symbol, "symbol precision mismatch");
+        require_auth(st.issuer);
+
+        check(owners.size() > 0, "owners is empty");
+        check(owners.size() <= MAX_SWEEP_ROWS, "too many owners, max: " + std::to_string(MAX_SWEEP_ROWS));
+        check(threshold.symbol == symbol, "symbol of threshold mismatch");
+        check(threshold.amount > 0, "threshold must be positive");
+        // only balances that transfer can not move, see min_fee_quant
+        check(threshold.amount <= st.min_fee_quant.amount + 1,
+              "threshold must not exceed min fee plus one unit: " + st.min_fee_quant.to_string());
+        check(to.value == 0 || to == st.fee_receiver, "swept balances can only go to the fee receiver");
+
+        asset swept = asset(0, symbol);
+        int64_t add_count = 0;
+        for (const auto &owner : owners) {
+            // system accounts keep their rows
+            if (owner == st.issuer || owner == st.fee_receiver || owner == to || st.is_system_account(owner)) continue;
+
+            auto &accts = get_accounts(owner);
+            auto itr = accts.find(sym_code_raw);
+            if (itr == accts.end()) continue;
+            auto balance = st.balance_of(owner, *itr);
+            if (balance >= threshold) continue;
+            if (itr->is_fee_exempted || itr->airdropmode_allow_transfer) continue;
+
+            if (balance.amount > 0) {
+                swept += balance;
+                add_count -= 1;
+            }
+            accts.erase(itr);
+            balance_changed(st, owner, balance, asset(0, symbol));
+        }
+
+        if (swept.amount > 0) {
+            if (to.value == 0) {
+                statstable.modify(st, same_payer, [&](auto &s) {
+                    s.upgrade();
+                    s.supply -= swept;
+                });
+            } else {
+                if (add_balance(st, to, swept, st.issuer)) {
+                    add_count += 1;
+                }
+            }
+        }
+        if (add_count != 0) {
+            add_holders(sym_code_raw, st.issuer, add_count);
+        }
+    }
+
+    void xtoken::accrue_fee(const uint64_t &sym_code_raw, const asset &fee, const metric_counters *counters) {
+        fee_accruals accruals(get_self(), sym_code_raw);
+        auto itr = accruals.find(sym_code_raw);
+        if (itr == accruals.end()) {
+            accruals.emplace(get_self(), [&](auto &f) {
+                f.accrued = fee;
+                if (counters != nullptr) f.counters.add(*counters);
+            });
+        } else {
+            accruals.modify(itr, same_payer, [&](auto &f) {
+                f.accrued += fee;
+                if (counters != nullptr) f.counters.add(*counters);
+            });
+        }
+    }
+
+    bool xtoken::settle_fees(const currency_stats &st) {
+        auto sym_code_raw = st.supply.symbol.code().raw();
+        fee_accruals accruals(get_self(), sym_code_raw);
+        auto itr = accruals.find(sym_code_raw);
+        if (itr == accruals.end() || itr->accrued.amount == 0) return false;
+
+        auto fee = itr->accrued;
+        accruals.modify(itr, same_payer, [&](auto &f) {
+            f.accrued.amount = 0;
+        });
+        if (add_balance(st, st.fee_receiver, fee, get_self())) {
+            add_holders(sym_code_raw, st.fee_receiver, 1);
+        }
+        notify(st.fee_receiver, NOTIFY_FEE);
+        return true;
+    }
+
     bool xtoken::sub_balance(const currency_stats &st, const name &owner, const asset &value,
                              bool is_check_frozen)
     {
-        accounts from_accts(get_self(), owner.value);
+        auto &from_accts = get_accounts(owner);
         const auto &from = from_accts.get(value.symbol.code().raw(), "no balance object found");
-        check(from.balance.amount >= value.amount, "overdrawn balance");
-        from_accts.modify(from, owner, [&](auto &a) {
-            a.balance -= value;
-        });
-        if (from.balance.amount == value.amount) {
+        return sub_balance(st, from_accts, from, value, owner);
+    }
+
+    bool xtoken::sub_balance(const currency_stats &st, accounts &accts, const account &acct, const asset &value,
+                             const name &ram_payer)
+    {
+        auto owner = name(accts.get_scope());
+        auto balance = st.balance_of(owner, acct);
+        check(balance.amount >= value.amount, "overdrawn balance");
+        if (    balance.amount == value.amount
+            &&  st.auto_reclaim.value_or()
+            &&  !acct.is_fee_exempted
+            &&  !acct.airdropmode_allow_transfer )
+        {
+            accts.erase(acct);
+            balance_changed(st, owner, balance, asset(0, value.symbol));
             return true;
         }
-        return false;
+        // a debit on behalf of the owner (transferfrom) keeps the row billed to its payer
+        accts.modify(acct, ram_payer == owner ? ram_payer : same_payer, [&](auto &a) {
+            st.settle(owner, a);
+            a.balance -= value;
+            a.upgrade();
+        });
+        balance_changed(st, owner, balance, acct.balance);
+        return acct.balance.amount == 0;
     }
 
     bool xtoken::add_balance(const currency_stats &st, const name &owner, const asset &value,
                              const name &ram_payer, bool is_check_frozen)
     {
-        accounts to_accts(get_self(), owner.value);
+        auto &to_accts = get_accounts(owner);
         auto to = to_accts.find(value.symbol.code().raw());
+        return add_balance(st, to_accts, to, owner, value, ram_payer);
+    }
+
+    bool xtoken::add_balance(const currency_stats &st, accounts &accts, accounts::const_iterator &itr, const name &owner,
+                             const asset &value, const name &ram_payer)
+    {
         auto ret = false;
-        if (to == to_accts.end())
+        auto before = asset(0, value.symbol);
+        if (itr == accts.end())
         {
-            to_accts.emplace(ram_payer, [&](auto &a) {
-                a.balance = value;
+            itr = accts.emplace(ram_payer, [&](auto &a) {
+                a.balance = asset(0, value.symbol);
+                st.settle(owner, a);
+                a.balance += value;
+                a.upgrade();
             });
             ret = true;
         }
         else
         {
-            if (to->balance.amount == 0) {
+            if (itr->balance.amount == 0) {
                 ret = true;
             }
-            to_accts.modify(to, same_payer, [&](auto &a) {
+            before = st.balance_of(owner, *itr);
+            accts.modify(itr, same_payer, [&](auto &a) {
+                st.settle(owner, a);
                 a.balance += value;
+                a.upgrade();
             });
         }
+        balance_changed(st, owner, before, itr->balance);
         return ret;
     }
 
+    void xtoken::balance_changed(const currency_stats &st, const name &owner, const asset &before, const asset &after)
+    {
+        update_holder(st, owner, after);
+        record_balance(st, owner, before, after);
+    }
+
+    void xtoken::record_balance(const currency_stats &st, const name &owner, const asset &before, const asset &after)
+    {
+        if (!st.history.value_or()) return;
+
+        auto now = current_block_time();
+        balance_histories histories(get_self(), owner.value);
+        auto itr = histories.find(after.symbol.code().raw());
+        if (itr == histories.end()) {
+            // a sender or spender never pays for the history of the account it credits
+            histories.emplace(has_auth(owner) ? owner : get_self(), [&](auto &h) {
+                h.sym = after.symbol;
+                // the balance before the first recorded change, back to when history was enabled
+                if (before.amount != 0) h.points.push_back({ block_timestamp(0), before.amount });
+                h.points.push_back({ now, after.amount });
+            });
+            return;
+        }
+
+        // the row grows, its owner takes it over the next time it signs
+        histories.modify(itr, has_auth(owner) ? owner : same_payer, [&](auto &h) {
+            auto &points = h.points;
+            // a row kept from before history was last enabled restarts with the balance it had then
+            auto since = block_timestamp(st.history_since.value_or());
+            if (points.back().at < since) points.push_back({ since, before.amount });
+            if (points.back().at == now) {
+                points.back().amount = after.amount;
+                return;
+            }
+            points.push_back({ now, after.amount });
+            if (points.size() <= MAX_BALANCE_POINTS) return;
+
+            // halve the resolution of the older half
+            auto half = points.size() / 2;
+            std::vector<balance_point> compacted;
+            for (size_t i = 0; i < points.size(); i++) {
+                if (i < half && i % 2 == 1) continue;
+                compacted.push_back(points[i]);
+            }
+            points = compacted;
+        });
+    }
+
+    void xtoken::update_holder(const currency_stats &st, const name &owner, const asset &balance)
+    {
+        if (!st.holder_index.value_or()) return;
+
+        // rows held before the index was enabled are added the next time they are written
+        holders holdertable(get_self(), balance.symbol.code().raw());
+        auto itr = holdertable.find(owner.value);
+        if (balance.amount == 0) {
+            if (itr != holdertable.end()) holdertable.erase(itr);
+        } else if (itr == holdertable.end()) {
+            holdertable.emplace(has_auth(owner) ? owner : get_self(), [&](auto &h) {
+                h.owner     = owner;
+                h.balance   = balance;
+            });
+        } else {
+            holdertable.modify(itr, has_auth(owner) ? owner : same_payer, [&](auto &h) {
+                h.balance   = balance;
+            });
+        }
+    }
+
     void xtoken::open(const name &owner, const symbol &symbol, const name &ram_payer)
     {
         require_auth(ram_payer);
@@ -198,12 +713,12 @@ namespace meme_token {
     }
 
     bool xtoken::open_account(const name &owner, const symbol &symbol, const name &ram_payer) {
-        accounts accts(get_self(), owner.value);
+        auto &accts = get_accounts(owner);
         auto it = accts.find(symbol.code().raw());
         if (it == accts.end())
         {
             accts.emplace(ram_payer, [&](auto &a)
-                          { a.balance = asset{0, symbol}; });
+                          { a.balance = asset{0, symbol}; a.upgrade(); });
             return true;
         }
         return false;
@@ -218,7 +733,7 @@ namespace meme_token {
         const auto &st = statstable.get(sym_code_raw, "token of symbol does not exist");
         check(st.supply.symbol == symbol, "symbol precision mismatch");
 
-        accounts accts(get_self(), owner.value);
+        auto &accts = get_accounts(owner);
         auto it = accts.find(sym_code_raw);
         check(it != accts.end(), "Balance row already deleted or never existed. Action won't have any effect.");
         check(it->balance.amount == 0, "Cannot close because the balance is not zero.");
@@ -226,17 +741,159 @@ namespace meme_token {
     }
 
     void xtoken::feeratio(const symbol &symbol, uint64_t fee_ratio) {
+        check(token_policy::fee || fee_ratio == 0, "transfer fee is not supported by this build");
         check(fee_ratio < RATIO_BOOST, "fee_ratio out of range");
         update_currency_field(symbol, fee_ratio, &currency_stats::fee_ratio);
     }
 
     void xtoken::feereceiver(const symbol &symbol, const name &fee_receiver) {
         check(is_account(fee_receiver), "Invalid account of fee_receiver");
+        // fees accrued so far belong to the current receiver
+        stats statstable(get_self(), symbol.code().raw());
+        const auto &st = statstable.get(symbol.code().raw(), "token of symbol does not exist");
+        check(st.supply.symbol == symbol, "symbol precision mismatch");
+        require_auth(st.issuer);
+        settle_fees(st);
+
         currency_stats st_out;
         update_currency_field(symbol, fee_receiver, &currency_stats::fee_receiver, &st_out);
         open_account(fee_receiver, symbol, st_out.issuer);
     }
 
+    void xtoken::feeburn(const symbol &symbol, const bool &fee_burn) {
+        check(token_policy::fee || !fee_burn, "transfer fee is not supported by this build");
+        auto sym_code_raw = symbol.code().raw();
+        stats statstable(get_self(), sym_code_raw);
+        const auto &st = statstable.get(sym_code_raw, "token of symbol does not exist");
+        check(st.supply.symbol == symbol, "symbol precision mismatch");
+        require_auth(st.issuer);
+        // fees accrued before switching to burn mode still belong to the receiver
+        settle_fees(st);
+        statstable.modify(st, same_payer, [&](auto &s) {
+            s.upgrade();
+            s.fee_burn = fee_burn;
+        });
+    }
+
+    void xtoken::reflection(const symbol &symbol, const bool &reflection) {
+        check(token_policy::reflection || !reflection, "reflection is not supported by this build");
+        auto sym_code_raw = symbol.code().raw();
+        stats statstable(get_self(), sym_code_raw);
+        const auto &st = statstable.get(sym_code_raw, "token of symbol does not exist");
+        check(st.supply.symbol == symbol, "symbol precision mismatch");
+        require_auth(st.issuer);
+        // holder rows store the balance of their last write, reflection would grow balances past them
+        check(!reflection || !st.holder_index.value_or(), "reflection is not supported with holder index");
+        // holders must own the whole supply when fees start growing their balances
+        settle_fees(st);
+        // the remainder no balance holds yet leaves reflection like any other fee
+        auto pending = reflection ? 0 : st.reflect_pending.value_or();
+        if (pending > 0 && !st.fee_burn.value_or()) accrue_fee(sym_code_raw, asset(pending, symbol), nullptr);
+        statstable.modify(st, same_payer, [&](auto &s) {
+            s.upgrade();
+            s.reflection = reflection;
+            if (reflection && s.reflect_index.value() == 0) s.reflect_index = REFLECT_SCALE;
+            if (pending > 0) {
+                if (s.fee_burn.value()) s.supply.amount -= pending;
+                s.reflect_pending = 0;
+            }
+        });
+    }
+
+    void xtoken::holderindex(const symbol &symbol, const bool &holder_index) {
+        auto sym_code_raw = symbol.code().raw();
+        stats statstable(get_self(), sym_code_raw);
+        const auto &st = statstable.get(sym_code_raw, "token of symbol does not exist");
+        check(st.supply.symbol == symbol, "symbol precision mismatch");
+        require_auth(st.issuer);
+        // unsettled reflection rewards outlive turning reflection off
+        check(!holder_index || st.reflect_index.value_or() == 0, "holder index is not supported after reflection");
+        statstable.modify(st, same_payer, [&](auto &s) {
+            s.upgrade();
+            s.holder_index = holder_index;
+        });
+    }
+
+    void xtoken::keephistory(const symbol &symbol, const bool &history) {
+        auto sym_code_raw = symbol.code().raw();
+        stats statstable(get_self(), sym_code_raw);
+        const auto &st = statstable.get(sym_code_raw, "token of symbol does not exist");
+        check(st.supply.symbol == symbol, "symbol precision mismatch");
+        require_auth(st.issuer);
+        statstable.modify(st, same_payer, [&](auto &s) {
+            s.upgrade();
+            // checkpoints miss the changes made while history was off
+            if (history && !s.history.value()) s.history_since = current_time_point();
+            s.history = history;
+        });
+    }
+
+    asset xtoken::balanceat(const name &owner, const symbol &symbol, const time_point_sec &at) {
+        return get_balance_at(get_self(), owner, symbol, at);
+    }
+
+    void xtoken::keepmetrics(const symbol &symbol, const bool &metrics) {
+        auto sym_code_raw = symbol.code().raw();
+        stats statstable(get_self(), sym_code_raw);
+        const auto &st = statstable.get(sym_code_raw, "token of symbol does not exist");
+        check(st.supply.symbol == symbol, "symbol precision mismatch");
+        require_auth(st.issuer);
+        statstable.modify(st, same_payer, [&](auto &s) {
+            s.upgrade();
+            s.metrics = metrics;
+        });
+    }
+
+    xtoken::token_metrics xtoken::getmetrics(const symbol_code &sym_code) {
+        stats statstable(get_self(), sym_code.raw());
+        const auto &st = statstable.get(sym_code.raw(), "token of symbol does not exist");
+        auto counters = st.counters.value_or();
+        fee_accruals accruals(get_self(), sym_code.raw());
+        auto fa = accruals.find(sym_code.raw());
+        if (fa != accruals.end()) counters.add(fa->counters);
+        holder_shards shards(get_self(), sym_code.raw());
+        for (const auto &h : shards) {
+            counters.add(h.counters);
+        }
+
+        const auto &sym = st.supply.symbol;
+        return { asset(counters.volume, sym), counters.transfers, asset(counters.fees, sym),
+                 asset(counters.retired, sym), counters.peak_holders };
+    }
+
+    std::vector<asset> xtoken::getbalances(const name &owner) {
+        std::vector<asset> balances;
+        auto &accts = get_accounts(owner);
+        for (const auto &acct : accts) {
+            balances.push_back(get_balance(get_self(), owner, acct.balance.symbol.code()));
+        }
+        return balances;
+    }
+
+    std::vector<xtoken::token_info> xtoken::gettokens(const std::vector<symbol_code> &sym_codes) {
+        check(sym_codes.size() <= MAX_QUERY_TOKENS, "too many symbols, max: " + std::to_string(MAX_QUERY_TOKENS));
+        std::vector<token_info> tokens;
+        for (const auto &sym_code : sym_codes) {
+            stats statstable(get_self(), sym_code.raw());
+            const auto &st = statstable.get(sym_code.raw(), "token of symbol does not exist");
+            tokens.push_back({ st.supply, st.max_supply, st.issuer, st.fee_ratio, st.fee_receiver, st.min_fee_quant,
+                               st.fee_burn.value_or(), st.reflection.value_or(), st.in_airdrop_mode() });
+        }
+        return tokens;
+    }
+
+    void xtoken::autoreclaim(const symbol &symbol, const bool &auto_reclaim) {
+        auto sym_code_raw = symbol.code().raw();
+        stats statstable(get_self(), sym_code_raw);
+        const auto &st = statstable.get(sym_code_raw, "token of symbol does not exist");
+        check(st.supply.symbol == symbol, "symbol precision mismatch");
+        require_auth(st.issuer);
+        statstable.modify(st, same_payer, [&](auto &s) {
+            s.upgrade();
+            s.auto_reclaim = auto_reclaim;
+        });
+    }
+
     void xtoken::minfee(const symbol &symbol, const asset &min_fee_quant) {
         check(min_fee_quant.symbol == symbol, "symbol of min_fee_quant  mismatch");
         check(min_fee_quant.amount > 0, "amount of min_fee_quant can not be negative");
@@ -250,11 +907,12 @@ namespace meme_token {
         check(st.supply.symbol == symbol, "symbol precision mismatch");
         require_auth(st.issuer);
 
-        accounts accts(get_self(), account.value);
+        auto &accts = get_accounts(account);
         const auto &acct = accts.get(sym_code_raw, "account of token does not exist");
 
         accts.modify(acct, st.issuer, [&](auto &a) {
              a.is_fee_exempted = is_fee_exempted;
+             a.upgrade();
         });
     }
 
@@ -268,6 +926,7 @@ namespace meme_token {
         check(st.supply.symbol == symbol, "symbol precision mismatch");
         require_auth(st.issuer);
         statstable.modify(st, same_payer, [&](auto &s) {
+            s.upgrade();
             s.*field = v;
             if (st_out != nullptr) *st_out = s;
         });
@@ -282,25 +941,111 @@ namespace meme_token {
         for(auto& account : acccouts) {
             check( is_account( account ), "account does not exist: " + account.to_string() );
         
-            accounts acnts( get_self(), account.value );
+            auto &acnts = get_accounts(account);
             auto itr = acnts.find( symbol.code().raw() );
             if( itr == acnts.end() ) {
                 acnts.emplace( _self, [&]( auto& a ){
                     a.balance                    = asset(0, symbol);
                     a.is_fee_exempted            = is_fee_exempted;
                     a.airdropmode_allow_transfer = airdropmode_allow_transfer;
+                    a.upgrade();
                 });
             } else {
                 acnts.modify( itr, _self, [&]( auto& a ) {
                     a.is_fee_exempted            = is_fee_exempted;
                     a.airdropmode_allow_transfer = airdropmode_allow_transfer;
+                    a.upgrade();
+                });
+            }
+        }
+    }
+    void xtoken::setsysaccts(const symbol &symbol, const std::vector<name> &accounts) {
+        check(has_auth( _gstate.admin) || has_auth( _gstate.applynewmeme_contract), "only admin or applynewmeme_contract can setsysaccts");
+        check_system_accounts(accounts);
+
+        auto sym_code_raw = symbol.code().raw();
+        stats statstable(get_self(), sym_code_raw);
+        const auto &st = statstable.get(sym_code_raw, "token of symbol does not exist");
+        check(st.supply.symbol == symbol, "symbol precision mismatch");
+
+        // settle the rows of the accounts joining or leaving the list, system accounts take no reflection rewards
+        if (st.reflect_index.value_or() != 0) {
+            auto settle_row = [&](const name &owner) {
+                auto &accts = get_accounts(owner);
+                auto itr = accts.find(sym_code_raw);
+                if (itr == accts.end()) return;
+                accts.modify(itr, same_payer, [&](auto &a) {
+                    st.settle(owner, a);
+                    a.upgrade();
                 });
+            };
+            for (const auto &owner : st.system_accounts.value_or()) {
+                if (std::find(accounts.begin(), accounts.end(), owner) == accounts.end()) settle_row(owner);
+            }
+            for (const auto &owner : accounts) {
+                if (!st.is_system_account(owner)) settle_row(owner);
             }
         }
+        statstable.modify(st, same_payer, [&](auto &s) {
+            s.upgrade();
+            s.system_accounts = accounts;
+        });
     }
+
     void xtoken::creatememe(const name &issuer, const asset &maximum_supply, const bool& airdrop_mode,
-                    const name& fee_receiver, const uint64_t& fee_ratio) {
+                    const name& fee_receiver, const uint64_t& fee_ratio, const bool& fee_burn) {
         require_auth(_gstate.applynewmeme_contract);
+        _create_meme(issuer, maximum_supply, airdrop_mode, fee_receiver, fee_ratio, fee_burn, {}, time_point_sec(), 1);
+        _add_balance( _gstate.applynewmeme_contract, maximum_supply, _self);
+    }
+
+    void xtoken::launch(const name &issuer, const asset &maximum_supply, const bool &airdrop_mode,
+                        const name &fee_receiver, const uint64_t &fee_ratio, const bool &fee_burn,
+                        const std::vector<name> &system_accounts, const std::vector<distribution_param> &distribution,
+                        const time_point_sec &airdrop_end) {
+        require_auth(_gstate.applynewmeme_contract);
+        check_system_accounts(system_accounts);
+        check(distribution.size() <= MAX_DISTRIBUTION_ROWS, "too many distributions, max: " + std::to_string(MAX_DISTRIBUTION_ROWS));
+
+        // validate everything first so the stats row is written once with the final holder count
+        asset rest = maximum_supply;
+        std::set<name> recipients;
+        for (const auto &d : distribution) {
+            check(d.quantity.symbol == maximum_supply.symbol, "symbol precision mismatch");
+            check(d.quantity.amount > 0, "must distribute positive quantity");
+            check(d.to != _gstate.applynewmeme_contract, "the rest of the supply goes to applynewmeme_contract");
+            check(is_account(d.to), "to account does not exist: " + d.to.to_string());
+            rest -= d.quantity;
+            check(rest.amount >= 0, "distribution exceeds maximum supply");
+            recipients.insert(d.to);
+        }
+
+        _create_meme(issuer, maximum_supply, airdrop_mode, fee_receiver, fee_ratio, fee_burn, system_accounts,
+                     airdrop_end, recipients.size() + (rest.amount > 0 ? 1 : 0));
+        const auto &st = get_stats(maximum_supply.symbol.code().raw(), "token of symbol does not exist");
+        for (const auto &d : distribution) {
+            add_balance(st, d.to, d.quantity, get_self());
+        }
+        if (rest.amount > 0) {
+            _add_balance( _gstate.applynewmeme_contract, rest, _self);
+        }
+    }
+
+    void xtoken::check_system_accounts(const std::vector<name> &accounts) {
+        check(accounts.size() <= MAX_SYSTEM_ACCOUNTS, "too many system accounts, max: " + std::to_string(MAX_SYSTEM_ACCOUNTS));
+        for(auto& account : accounts) {
+            check( is_account( account ), "account does not exist: " + account.to_string() );
+        }
+    }
+
+    void xtoken::_create_meme(const name &issuer, const asset &maximum_supply, const bool &airdrop_mode,
+                              const name &fee_receiver, const uint64_t &fee_ratio, const bool &fee_burn,
+                              const std::vector<name> &system_accounts, const time_point_sec &airdrop_end,
+                              const uint64_t &total_accounts) {
+        check(token_policy::fee || fee_ratio == 0, "transfer fee is not supported by this build");
+        check(token_policy::airdrop_gate || !airdrop_mode, "airdrop mode is not supported by this build");
+        check(airdrop_end == time_point_sec() || (airdrop_mode && airdrop_end > time_point_sec(current_time_point())),
+              "airdrop end must be in the future and needs airdrop mode");
         //创建token
         check(is_account(issuer), "issuer account does not exist");
         const auto &sym = maximum_supply.symbol;
@@ -313,7 +1058,7 @@ namespace meme_token {
         auto existing = statstable.find(sym_code_raw);
         check(existing == statstable.end(), "token with symbol already exists:" + sym.code().to_string());
 
-        statstable.emplace(get_self(), [&](auto &s) {
+        auto st = statstable.emplace(get_self(), [&](auto &s) {
             s.supply            = maximum_supply;
             s.max_supply        = maximum_supply;
             s.issuer            = issuer;
@@ -321,52 +1066,75 @@ namespace meme_token {
             s.airdrop_mode      = airdrop_mode;
             s.fee_receiver      = fee_receiver;
             s.fee_ratio         = fee_ratio;
-            s.total_accounts    = 1;
+            s.total_accounts    = total_accounts;
+            s.fee_burn          = fee_burn;
+            s.upgrade();
+            s.system_accounts   = system_accounts;
+            s.airdrop_end       = airdrop_end;
         });
-        _add_balance( _gstate.applynewmeme_contract, maximum_supply, _self);
+        register_token(*st);
     }
     void xtoken::_add_balance( const name &owner, const asset &value, const name &ram_payer)
     {
-        accounts to_accts(get_self(), owner.value);
+        auto &to_accts = get_accounts(owner);
         auto to = to_accts.find(value.symbol.code().raw());
         if (to == to_accts.end()) {
             to_accts.emplace(ram_payer, [&](auto &a) {
                 a.balance = value;
                 a.is_fee_exempted = true;
                 a.airdropmode_allow_transfer = true;
+                a.upgrade();
             });
         } else { 
                 to_accts.modify(to, same_payer, [&](auto &a) {
                 a.balance += value;
+                a.upgrade();
             });
         }
     }
 
     void xtoken::_add_whitelist(const name &owner, const symbol &symbol, const name &ram_payer)
     {
-        accounts to_accts(get_self(), owner.value);
+        auto &to_accts = get_accounts(owner);
         auto to = to_accts.find(symbol.code().raw());
         if (to == to_accts.end()) {
             to_accts.emplace(ram_payer, [&](auto &a) {
                 a.balance = asset(0, symbol);
                 a.is_fee_exempted = true;
                 a.airdropmode_allow_transfer = true;
+                a.upgrade();
             });
         } else { 
                 to_accts.modify(to, same_payer, [&](auto &a) {
                 a.is_fee_exempted = true;
                 a.airdropmode_allow_transfer = true;
+                a.upgrade();
             });
         }
     }
 
 
+    void xtoken::airdropend(const symbol &symbol, const time_point_sec &ended_at) {
+        check(has_auth( _gstate.admin) || has_auth( _gstate.applynewmeme_contract), "only admin or applynewmeme_contract can airdropend");
+        auto sym_code_raw = symbol.code().raw();
+        stats statstable(get_self(), sym_code_raw);
+        const auto &st = statstable.get(sym_code_raw, "token of symbol does not exist");
+        check(st.supply.symbol == symbol, "symbol precision mismatch");
+        check(st.in_airdrop_mode(), "token is not in airdrop mode");
+        check(ended_at == time_point_sec() || ended_at > time_point_sec(current_time_point()), "end time must be in the future");
+        statstable.modify(st, same_payer, [&](auto &s) {
+            s.upgrade();
+            s.airdrop_end = ended_at;
+        });
+    }
+
     void xtoken::closeairdrop( const symbol& symbol) {
         require_auth(_gstate.applynewmeme_contract);
         auto sym_code_raw = symbol.code().raw();
         stats statstable(get_self(), sym_code_raw);
         const auto &st = statstable.get(sym_code_raw, "token of symbol does not exist");
         statstable.modify(st, same_payer, [&](auto &s) {
+            s.upgrade();
             s.airdrop_mode = false;
         });
 